@@ -0,0 +1,370 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * Header-only C++ layer of the JSON parser utility library.
+ *
+ * Values are reported to a handler given as a template parameter, typically a lambda, instead of a cy_JSON_callback_t
+ * and its user argument: the handler is called directly, and can be inlined, by the callback of the parser context.
+ * The parser reports the hash of the path of each value (CY_JSON_OPTION_PATH_HASH), and cy_json::hash() computes the
+ * hash of a path at compile time, so a handler dispatches the values with a switch on a single integer instead of
+ * comparing member names. Bindings of paths to the members of a structure are declared with cy_json::binding, and
+ * decoded with the dispatch unrolled at compile time.
+ *
+ * Example:
+ * @code
+ * struct reported_t { int32_t temp; char mode[ 8 ]; bool on; };
+ *
+ * typedef cy_json::binding< reported_t,
+ *                           CY_JSON_BIND( "state.reported.temp", &reported_t::temp ),
+ *                           CY_JSON_BIND( "state.reported.mode", &reported_t::mode ),
+ *                           CY_JSON_BIND( "state.reported.on", &reported_t::on ) > reported_binding;
+ *
+ * result = reported_binding::decode( reported, json_input, input_length );
+ *
+ * result = cy_json::parse( json_input, input_length, [ & ]( const cy_JSON_object_t& value ) -> cy_rslt_t
+ * {
+ *     switch ( value.path_hash )
+ *     {
+ *         case cy_json::hash( "state.reported.temp" ):
+ *             temp = (int32_t)value.int64val;
+ *             break;
+ *         case cy_json::hash( "state.reported.on" ):
+ *             on = value.boolval;
+ *             break;
+ *     }
+ *     return CY_RSLT_SUCCESS;
+ * } );
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <limits>
+#include <type_traits>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/** Bind the JSON value at `path`, a string literal, to `member`, a pointer to a member of a structure, in a cy_json::binding */
+#define CY_JSON_BIND( path, member ) ::cy_json::field< ::cy_json::hash( path ), decltype( member ), member >
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+namespace cy_json
+{
+
+namespace detail
+{
+
+constexpr uint32_t hash_continue( const char* path, uint32_t hash )
+{
+    return ( *path == '\0' ) ? hash : hash_continue( path + 1, static_cast< uint32_t >( ( hash ^ static_cast< uint8_t >( *path ) ) * CY_JSON_PATH_HASH_PRIME ) );
+}
+
+/* Store a JSON value into a structure member of the matching type. null leaves the member unchanged */
+inline cy_rslt_t assign( bool& member, const cy_JSON_object_t& value )
+{
+    if ( value.value_type != JSON_BOOLEAN_TYPE )
+    {
+        return ( value.value_type == JSON_NULL_TYPE ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+    member = value.boolval;
+
+    return CY_RSLT_SUCCESS;
+}
+
+template < typename M >
+inline typename std::enable_if< std::is_integral< M >::value && std::is_signed< M >::value, cy_rslt_t >::type assign( M& member, const cy_JSON_object_t& value )
+{
+    /* Integers saturate to the range of int64_t: a saturated value, or an unsigned value above it, does not fit */
+    if ( ( value.value_type != JSON_NUMBER_TYPE ) || !value.exact_integer || ( value.uint64val > static_cast< uint64_t >( INT64_MAX ) ) ||
+         ( value.int64val < std::numeric_limits< M >::min() ) || ( value.int64val > std::numeric_limits< M >::max() ) )
+    {
+        return ( value.value_type == JSON_NULL_TYPE ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+    member = static_cast< M >( value.int64val );
+
+    return CY_RSLT_SUCCESS;
+}
+
+template < typename M >
+inline typename std::enable_if< std::is_integral< M >::value && std::is_unsigned< M >::value && !std::is_same< M, bool >::value, cy_rslt_t >::type assign( M& member, const cy_JSON_object_t& value )
+{
+    if ( ( value.value_type != JSON_NUMBER_TYPE ) || !value.exact_integer || ( value.int64val < 0 ) || ( value.uint64val > std::numeric_limits< M >::max() ) )
+    {
+        return ( value.value_type == JSON_NULL_TYPE ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+    member = static_cast< M >( value.uint64val );
+
+    return CY_RSLT_SUCCESS;
+}
+
+#if defined( CY_JSON_FIXED_POINT ) && defined( CY_JSON_FIXED_POINT_DECIMALS )
+/* Value of 1 in fixedval */
+constexpr double fixed_one( uint32_t decimals )
+{
+    return ( decimals == 0 ) ? 1.0 : ( 10.0 * fixed_one( decimals - 1 ) );
+}
+#endif
+
+template < typename M >
+inline typename std::enable_if< std::is_floating_point< M >::value, cy_rslt_t >::type assign( M& member, const cy_JSON_object_t& value )
+{
+    if ( ( value.value_type != JSON_NUMBER_TYPE ) && ( value.value_type != JSON_FLOAT_TYPE ) )
+    {
+        return ( value.value_type == JSON_NULL_TYPE ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+#ifdef CY_JSON_FIXED_POINT
+#ifdef CY_JSON_FIXED_POINT_DECIMALS
+    member = static_cast< M >( value.fixedval ) / static_cast< M >( fixed_one( CY_JSON_FIXED_POINT_DECIMALS ) );
+#else
+    member = static_cast< M >( value.fixedval ) / static_cast< M >( 1UL << CY_JSON_FIXED_POINT_FRACTION_BITS );
+#endif
+#else
+    member = static_cast< M >( value.doubleval );
+#endif
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Strings are decoded with their escape sequences and NUL terminated */
+template < uint32_t N >
+inline cy_rslt_t assign( char ( &member )[ N ], const cy_JSON_object_t& value )
+{
+    cy_rslt_t result;
+    uint32_t  length;
+
+    static_assert( N > 0, "string members need room for the NUL terminator" );
+
+    if ( value.value_type != JSON_STRING_TYPE )
+    {
+        return ( value.value_type == JSON_NULL_TYPE ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+    result = cy_JSON_unescape( value.value, value.value_length, member, N - 1, &length );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+    member[ length ] = '\0';
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Compare the path hash of the value with the path hash of each field in turn, unrolled at compile time */
+template < typename T, typename... Fields >
+struct dispatch;
+
+template < typename T >
+struct dispatch< T >
+{
+    static cy_rslt_t decode( T&, const cy_JSON_object_t& )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+};
+
+template < typename T, typename Field, typename... Rest >
+struct dispatch< T, Field, Rest... >
+{
+    static cy_rslt_t decode( T& object, const cy_JSON_object_t& value )
+    {
+        return ( value.path_hash == Field::path_hash ) ? Field::decode( object, value ) : dispatch< T, Rest... >::decode( object, value );
+    }
+};
+
+} /* namespace detail */
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Compute the hash of the path of a value at compile time, the same as @ref cy_JSON_path_hash
+ *
+ * @param[in] path : NUL terminated path of the value, for instance "state.reported.temp" or "jobs[*].id"
+ *
+ * @return Hash of the path
+ */
+constexpr uint32_t hash( const char* path )
+{
+    return detail::hash_continue( path, CY_JSON_PATH_HASH_INIT );
+}
+
+/** JSON parser context reporting the values to a handler of type `Handler`
+ *
+ * The handler is called as `cy_rslt_t handler( const cy_JSON_object_t& value )` and returns the same results as a
+ * @ref cy_JSON_callback_t. The context registers its own address with the C parser: it can be neither copied nor moved.
+ */
+template < typename Handler >
+class parser
+{
+public:
+    /** Initialize the parser context
+     *
+     * @param[in] handler : Handler of the values, referenced by the context
+     * @param[in] options : CY_JSON_OPTION_ flags of the context, see @ref cy_JSON_parser_ctx_set_options
+     */
+    explicit parser( Handler& handler, uint32_t options = CY_JSON_OPTION_PATH_HASH ) : handler_( handler )
+    {
+        cy_JSON_parser_ctx_init( &ctx_ );
+        cy_JSON_parser_ctx_set_options( &ctx_, options );
+        cy_JSON_parser_ctx_register_callback( &ctx_, &parser::callback, this );
+    }
+
+    parser( const parser& ) = delete;
+    parser& operator=( const parser& ) = delete;
+
+    /** Parse JSON data, see @ref cy_JSON_parser_ctx_parse */
+    cy_rslt_t parse( const char* json_input, uint32_t input_length )
+    {
+        return cy_JSON_parser_ctx_parse( &ctx_, json_input, input_length );
+    }
+
+    /** Parse JSON data held in a writable buffer, see @ref cy_JSON_parser_ctx_parse_in_place */
+    cy_rslt_t parse_in_place( char* json_input, uint32_t input_length )
+    {
+        return cy_JSON_parser_ctx_parse_in_place( &ctx_, json_input, input_length );
+    }
+
+    /** Returns the C parser context, to set its token buffer, its stack or its record callback */
+    cy_JSON_parser_ctx_t* context( void )
+    {
+        return &ctx_;
+    }
+
+private:
+    static cy_rslt_t callback( cy_JSON_object_t* json_object, void* arg )
+    {
+        return static_cast< parser* >( arg )->handler_( static_cast< const cy_JSON_object_t& >( *json_object ) );
+    }
+
+    cy_JSON_parser_ctx_t ctx_;
+    Handler&             handler_;
+};
+
+/** Parse a JSON document held in a single buffer, reporting its values to `handler`
+ *
+ * @param[in] json_input   : Pointer to the JSON data
+ * @param[in] input_length : Length of the JSON data
+ * @param[in] handler      : Handler of the values, see @ref cy_json::parser
+ * @param[in] options      : CY_JSON_OPTION_ flags, see @ref cy_JSON_parser_ctx_set_options
+ *
+ * @return Same as @ref cy_JSON_parser_ctx_parse
+ */
+template < typename Handler >
+inline cy_rslt_t parse( const char* json_input, uint32_t input_length, Handler handler, uint32_t options = CY_JSON_OPTION_PATH_HASH )
+{
+    parser< Handler > json_parser( handler, options );
+
+    return json_parser.parse( json_input, input_length );
+}
+
+/** Binding of the JSON value at the path of hash `Hash` to the structure member `Pointer`. Declared with @ref CY_JSON_BIND
+ *
+ * Members of type bool, integer, float, double and char array are supported. Strings are decoded with their escape
+ * sequences and NUL terminated. Integers must fit in the member.
+ */
+template < uint32_t Hash, typename Member, Member Pointer >
+struct field
+{
+    static const uint32_t path_hash = Hash;     /**< Hash of the path of the value */
+
+    /** Store the value into the member of `object` */
+    template < typename T >
+    static cy_rslt_t decode( T& object, const cy_JSON_object_t& value )
+    {
+        return detail::assign( object.*Pointer, value );
+    }
+};
+
+/** Bindings of JSON values to the members of a structure of type `T`, each declared with @ref CY_JSON_BIND
+ *
+ * Values whose path is not bound are ignored, and null values leave their member unchanged. Paths are matched with
+ * their hash, with member names as they appear in the JSON data.
+ */
+template < typename T, typename... Fields >
+struct binding
+{
+    /** Store a value reported with CY_JSON_OPTION_PATH_HASH into the member bound to its path, if any
+     *
+     * @return on success - CY_RSLT_SUCCESS
+     *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the value does not fit in the member
+     *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if a string does not fit in the member
+     */
+    static cy_rslt_t decode_value( T& object, const cy_JSON_object_t& value )
+    {
+        return detail::dispatch< T, Fields... >::decode( object, value );
+    }
+
+    /** Decode a JSON document held in a single buffer into `object`
+     *
+     * @return on success - CY_RSLT_SUCCESS
+     *         on failure - Same as @ref decode_value, or as @ref cy_JSON_parser_ctx_parse
+     */
+    static cy_rslt_t decode( T& object, const char* json_input, uint32_t input_length )
+    {
+        return cy_json::parse( json_input, input_length, [ &object ]( const cy_JSON_object_t& value ) -> cy_rslt_t
+        {
+            return decode_value( object, value );
+        } );
+    }
+};
+
+/** @} */
+
+} /* namespace cy_json */
@@ -0,0 +1,431 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_batch.h"
+#include "cy_json_scan.h"
+#include <stddef.h>
+#include <string.h>
+#ifdef CY_JSON_BATCH_THREADS
+#include <pthread.h>
+#endif
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/* A part of the batch and the context parsing it */
+typedef struct
+{
+    cy_JSON_parser_ctx_t*   ctx;
+    const char*             input;
+    uint32_t                length;
+    bool                    open;       /* The part is a range of array elements, parsed after a '[' */
+    bool                    close;      /* The part is a range of array elements, parsed before a ']' */
+    cy_rslt_t               result;
+} json_batch_part_t;
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+static void json_batch_parse_part( json_batch_part_t* part )
+{
+    char      token_buffer[ CY_JSON_BATCH_TOKEN_BUFFER_SIZE ];
+    bool      own_buffer = ( part->close && ( part->ctx->token_buffer == NULL ) );
+    cy_rslt_t result     = CY_RSLT_JSON_INCOMPLETE;
+
+    cy_JSON_parser_ctx_reset( part->ctx );
+
+    /* The number or literal ending a range is only complete once the ']' is parsed, in a separate input buffer */
+    if ( own_buffer )
+    {
+        cy_JSON_parser_ctx_set_token_buffer( part->ctx, token_buffer, sizeof( token_buffer ) );
+    }
+
+    /* A range of array elements is parsed as the elements of an array of its own */
+    if ( part->open )
+    {
+        result = cy_JSON_parser_ctx_parse( part->ctx, "[", 1 );
+    }
+    if ( result == CY_RSLT_JSON_INCOMPLETE )
+    {
+        result = cy_JSON_parser_ctx_parse( part->ctx, part->input, part->length );
+    }
+    if ( ( result == CY_RSLT_JSON_INCOMPLETE ) && part->close )
+    {
+        result = cy_JSON_parser_ctx_parse( part->ctx, "]", 1 );
+    }
+
+    if ( own_buffer )
+    {
+        cy_JSON_parser_ctx_set_token_buffer( part->ctx, NULL, 0 );
+    }
+
+    part->result = result;
+}
+
+#ifdef CY_JSON_BATCH_THREADS
+static void* json_batch_thread( void* arg )
+{
+    json_batch_parse_part( (json_batch_part_t*)arg );
+
+    return NULL;
+}
+#endif
+
+/* Parses the parts, in parallel with CY_JSON_BATCH_THREADS, and returns the first error in batch order */
+static cy_rslt_t json_batch_parse_parts( json_batch_part_t* parts, uint32_t part_count )
+{
+    uint32_t  i;
+#ifdef CY_JSON_BATCH_THREADS
+    pthread_t threads[ CY_JSON_BATCH_MAX_PARTS ];
+    uint32_t  started;
+
+    /* The calling thread parses the first part while the worker threads parse the others */
+    for ( started = 1; started < part_count; started++ )
+    {
+        if ( pthread_create( &threads[ started ], NULL, json_batch_thread, &parts[ started ] ) != 0 )
+        {
+            break;
+        }
+    }
+    json_batch_parse_part( &parts[ 0 ] );
+    for ( i = 1; i < started; i++ )
+    {
+        pthread_join( threads[ i ], NULL );
+    }
+#else
+    for ( i = 0; i < part_count; i++ )
+    {
+        json_batch_parse_part( &parts[ i ] );
+    }
+#endif
+
+    for ( i = 0; i < part_count; i++ )
+    {
+        if ( parts[ i ].result != CY_RSLT_SUCCESS )
+        {
+            return parts[ i ].result;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Returns the position following the end of the string starting at position, or end if the string is not terminated */
+static const char* json_batch_skip_string( const char* position, const char* end )
+{
+    while ( ( position = cy_json_scan_string( position, end ) ) < end )
+    {
+        if ( *position == '"' )
+        {
+            return position + 1;
+        }
+        if ( *position == '\\' )
+        {
+            /* Skip the escaped character, which may be a '"' */
+            if ( ( end - position ) < 2 )
+            {
+                return end;
+            }
+            position++;
+        }
+        position++;
+    }
+
+    return end;
+}
+
+/* Returns true if the comma at position separates two elements, so that the array stays well-formed once split there */
+static bool json_batch_is_separator( const char* json_input, const char* position, const char* end )
+{
+    const char* previous = position;
+    const char* next;
+
+    do
+    {
+        previous--;
+    } while ( ( previous > json_input ) && ( ( *previous == ' ' ) || ( *previous == '\t' ) || ( *previous == '\r' ) || ( *previous == '\n' ) ) );
+
+    next = cy_json_scan_whitespace( position + 1, end );
+
+    return ( *previous != '[' ) && ( *previous != ',' ) && ( next < end ) && ( *next != ']' ) && ( *next != ',' );
+}
+
+
+cy_rslt_t cy_JSON_batch_split( const char* json_input, uint32_t input_length, uint32_t* part_ends, uint32_t* part_count )
+{
+    const char* newline;
+    uint32_t    start = 0;
+    uint32_t    target;
+    uint32_t    count = 0;
+    uint32_t    i;
+
+    if ( ( ( json_input == NULL ) && ( input_length != 0 ) ) || ( part_ends == NULL ) || ( part_count == NULL ) || ( *part_count == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* Each part ends after the first newline following its share of the batch */
+    for ( i = 1; ( i < *part_count ) && ( start < input_length ); i++ )
+    {
+        target = (uint32_t)( ( (uint64_t)input_length * i ) / *part_count );
+        target = ( target > start ) ? target : start;
+
+        newline = memchr( json_input + target, '\n', input_length - target );
+        if ( newline == NULL )
+        {
+            break;
+        }
+        start                = (uint32_t)( newline - json_input ) + 1;
+        part_ends[ count++ ] = start;
+    }
+
+    if ( ( start < input_length ) || ( count == 0 ) )
+    {
+        part_ends[ count++ ] = input_length;
+    }
+    *part_count = count;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_batch_parse( cy_JSON_parser_ctx_t* contexts, uint32_t context_count, const char* json_input, uint32_t input_length, uint32_t* record_count )
+{
+    json_batch_part_t parts[ CY_JSON_BATCH_MAX_PARTS ];
+    uint32_t          part_ends[ CY_JSON_BATCH_MAX_PARTS ];
+    uint32_t          part_count = context_count;
+    uint32_t          start      = 0;
+    uint32_t          records    = 0;
+    uint32_t          i;
+    cy_rslt_t         result;
+
+    if ( ( contexts == NULL ) || ( context_count > CY_JSON_BATCH_MAX_PARTS ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    result = cy_JSON_batch_split( json_input, input_length, part_ends, &part_count );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    for ( i = 0; i < part_count; i++ )
+    {
+        parts[ i ].ctx    = &contexts[ i ];
+        parts[ i ].input  = json_input + start;
+        parts[ i ].length = part_ends[ i ] - start;
+        parts[ i ].open   = false;
+        parts[ i ].close  = false;
+        parts[ i ].result = CY_RSLT_JSON_GENERIC_ERROR;
+        start             = part_ends[ i ];
+    }
+
+    result = json_batch_parse_parts( parts, part_count );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    for ( i = 0; i < part_count; i++ )
+    {
+        records += parts[ i ].ctx->record_count;
+    }
+
+    if ( record_count != NULL )
+    {
+        *record_count = records;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_batch_split_array( const char* json_input, uint32_t input_length, uint32_t* part_ends, uint32_t* part_count )
+{
+    const char* end;
+    const char* position;
+    const char* gap;
+    const char* search;
+    const char* comma;
+    uint32_t    target;
+    uint32_t    count = 0;
+    uint32_t    depth = 1;
+
+    if ( ( json_input == NULL ) || ( part_ends == NULL ) || ( part_count == NULL ) || ( *part_count == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    end      = json_input + input_length;
+    position = cy_json_scan_whitespace( json_input, end );
+    if ( ( position == end ) || ( *position != '[' ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    /* Walk the structure of the array with the skip scanner. Between two structural characters at depth 1, the input
+     * only holds numbers, literals, whitespace and the commas separating the elements: each part ends at the first
+     * such comma following its share of the array.
+     */
+    position++;
+    gap    = position;
+    target = input_length / *part_count;
+    while ( ( count + 1 ) < *part_count )
+    {
+        position = cy_json_scan_skip( gap, end );
+
+        if ( depth == 1 )
+        {
+            search = ( ( json_input + target ) > gap ) ? ( json_input + target ) : gap;
+            comma  = ( search < position ) ? memchr( search, ',', (size_t)( position - search ) ) : NULL;
+            if ( comma != NULL )
+            {
+                if ( !json_batch_is_separator( json_input, comma, end ) )
+                {
+                    return CY_RSLT_JSON_GENERIC_ERROR;
+                }
+                part_ends[ count++ ] = (uint32_t)( comma - json_input );
+                target               = (uint32_t)( ( (uint64_t)input_length * ( count + 1 ) ) / *part_count );
+                gap                  = comma + 1;
+                continue;
+            }
+        }
+
+        if ( position == end )
+        {
+            break;
+        }
+
+        switch ( *position )
+        {
+            case '"':
+                position = json_batch_skip_string( position + 1, end );
+                break;
+
+            case '{':
+            case '[':
+                depth++;
+                position++;
+                break;
+
+            default:
+                depth--;
+                position++;
+                break;
+        }
+
+        if ( depth == 0 )
+        {
+            break;
+        }
+        gap = position;
+    }
+
+    part_ends[ count++ ] = input_length;
+    *part_count          = count;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_batch_parse_array( cy_JSON_parser_ctx_t* contexts, uint32_t context_count, const char* json_input, uint32_t input_length )
+{
+    json_batch_part_t parts[ CY_JSON_BATCH_MAX_PARTS ];
+    uint32_t          part_ends[ CY_JSON_BATCH_MAX_PARTS ];
+    uint32_t          part_count = context_count;
+    uint32_t          start      = 0;
+    uint32_t          i;
+    const char*       element;
+    cy_rslt_t         result;
+
+    if ( ( contexts == NULL ) || ( context_count > CY_JSON_BATCH_MAX_PARTS ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    result = cy_JSON_batch_split_array( json_input, input_length, part_ends, &part_count );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    /* The first part holds the '[' of the array and the last part its ']', the commas between parts are left out */
+    for ( i = 0; i < part_count; i++ )
+    {
+        /* Parts after the first one start with an element: the '[' added in front of them must not hide a missing one */
+        element = cy_json_scan_whitespace( json_input + start, json_input + part_ends[ i ] );
+        if ( ( i != 0 ) && ( ( element == json_input + part_ends[ i ] ) || ( *element == ']' ) || ( *element == ',' ) ) )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+
+        parts[ i ].ctx    = &contexts[ i ];
+        parts[ i ].input  = json_input + start;
+        parts[ i ].length = part_ends[ i ] - start;
+        parts[ i ].open   = ( i != 0 );
+        parts[ i ].close  = ( i != ( part_count - 1 ) );
+        parts[ i ].result = CY_RSLT_JSON_GENERIC_ERROR;
+        start             = part_ends[ i ] + 1;
+    }
+
+    return json_batch_parse_parts( parts, part_count );
+}
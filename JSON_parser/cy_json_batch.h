@@ -0,0 +1,186 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/**
+ * @file
+ * The JSON batch utility parses batches of newline-delimited JSON records, such as NDJSON, held in memory.
+ *
+ * A JSON parser context parses consecutive records by itself, reporting the end of each one to its record callback, see
+ * @ref cy_JSON_parser_ctx_register_record_callback. This utility splits a batch into parts at line boundaries, so that
+ * its parts can be parsed independently, each with its own parser context. JSON strings cannot contain raw newlines,
+ * so a line boundary is always a record boundary.
+ *
+ * It also splits a large top-level JSON array into ranges of elements, walking the structure of the array with the
+ * skip scanner, so that the ranges can be parsed independently in the same way.
+ *
+ * On hosts with POSIX threads, define CY_JSON_BATCH_THREADS to parse the parts in parallel, one thread per part.
+ * Otherwise the parts are parsed one after the other, in the calling thread.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/** Maximum number of parts a batch is split into by @ref cy_JSON_batch_parse */
+#ifndef CY_JSON_BATCH_MAX_PARTS
+#define CY_JSON_BATCH_MAX_PARTS (8)
+#endif
+
+/** Size of the token buffer lent to a parser context without one, to parse the number or literal ending a range of
+ *  array elements split by @ref cy_JSON_batch_parse_array */
+#ifndef CY_JSON_BATCH_TOKEN_BUFFER_SIZE
+#define CY_JSON_BATCH_TOKEN_BUFFER_SIZE (64)
+#endif
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Split a batch of newline-delimited JSON records into parts of about the same length, ending at line boundaries
+ *
+ * @param[in]     json_input   : Pointer to the batch
+ * @param[in]     input_length : Length of the batch
+ * @param[out]    part_ends    : Set to the offset of the end of each part in the batch. A part starts at the end of the
+ *                               previous part, the first part at the start of the batch.
+ * @param[in,out] part_count   : Number of parts wanted, at least 1, and size of `part_ends`. Set to the number of parts,
+ *                               which is lower when there are not enough lines.
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_batch_split( const char* json_input, uint32_t input_length, uint32_t* part_ends, uint32_t* part_count );
+
+/** Parse a batch of newline-delimited JSON records, split into as many parts as there are parser contexts
+ *
+ * Each context is reset, then parses one part, invoking the callbacks registered with it. With CY_JSON_BATCH_THREADS,
+ * the parts are parsed in parallel and the callbacks of different contexts are invoked concurrently. The records of
+ * each part are counted from 0 by the record callback of its context.
+ *
+ * @param[in]  contexts      : Array of initialized JSON parser contexts
+ * @param[in]  context_count : Number of contexts, from 1 to CY_JSON_BATCH_MAX_PARTS
+ * @param[in]  json_input    : Pointer to the batch
+ * @param[in]  input_length  : Length of the batch
+ * @param[out] record_count  : Optional; set to the number of records parsed in all the parts
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the last record is truncated
+ *                    - The first error met in the parts, in batch order, as returned by @ref cy_JSON_parser_ctx_parse
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if a worker thread cannot be created
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_batch_parse( cy_JSON_parser_ctx_t* contexts, uint32_t context_count, const char* json_input, uint32_t input_length, uint32_t* record_count );
+
+/** Split a JSON document whose root is an array into parts of about the same length, each holding a range of elements
+ *
+ * The parts are separated by the comma following the last element of each part, which belongs to no part.
+ *
+ * @param[in]     json_input   : Pointer to the JSON document
+ * @param[in]     input_length : Length of the JSON document
+ * @param[out]    part_ends    : Set to the offset of the end of each part in the document, the offset of the separating
+ *                               comma except for the last part, which ends at the end of the document. The first part
+ *                               starts at the start of the document, the others after the comma ending the previous part.
+ * @param[in,out] part_count   : Number of parts wanted, at least 1, and size of `part_ends`. Set to the number of parts,
+ *                               which is lower when there are not enough elements.
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the root of the document is not an array
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if a comma chosen to end a part does not separate two elements
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_batch_split_array( const char* json_input, uint32_t input_length, uint32_t* part_ends, uint32_t* part_count );
+
+/** Parse a JSON document whose root is an array, split into as many ranges of elements as there are parser contexts
+ *
+ * Each context is reset, then parses the elements of one range as the elements of an array of its own, invoking the
+ * callbacks registered with it: each context reports a root array, holding the elements of its range. With
+ * CY_JSON_BATCH_THREADS, the ranges are parsed in parallel and the callbacks of different contexts are invoked
+ * concurrently.
+ *
+ * @param[in]  contexts      : Array of initialized JSON parser contexts
+ * @param[in]  context_count : Number of contexts, from 1 to CY_JSON_BATCH_MAX_PARTS
+ * @param[in]  json_input    : Pointer to the JSON document
+ * @param[in]  input_length  : Length of the JSON document
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the document is truncated
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the root of the document is not an array
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if an element is missing where the array is split
+ *                    - The first error met in the ranges, in document order, as returned by @ref cy_JSON_parser_ctx_parse
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if a worker thread cannot be created
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_batch_parse_array( cy_JSON_parser_ctx_t* contexts, uint32_t context_count, const char* json_input, uint32_t input_length );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
@@ -0,0 +1,822 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_cbor.h"
+#include "cy_json_parser_private.h"
+#include <string.h>
+#include <math.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* CBOR major types */
+#define JSON_CBOR_UNSIGNED                 (0)
+#define JSON_CBOR_NEGATIVE                 (1)
+#define JSON_CBOR_BYTES                    (2)
+#define JSON_CBOR_TEXT                     (3)
+#define JSON_CBOR_ARRAY                    (4)
+#define JSON_CBOR_MAP                      (5)
+#define JSON_CBOR_TAG                      (6)
+#define JSON_CBOR_SIMPLE                   (7)
+
+/* Additional information of the initial byte */
+#define JSON_CBOR_INFO_ONE_BYTE            (24)
+#define JSON_CBOR_INFO_INDEFINITE          (31)
+
+/* Initial bytes of the CBOR values written by the encoder */
+#define JSON_CBOR_FALSE                    (0xF4)
+#define JSON_CBOR_TRUE                     (0xF5)
+#define JSON_CBOR_NULL                     (0xF6)
+#define JSON_CBOR_FLOAT                    (0xFA)
+#define JSON_CBOR_DOUBLE                   (0xFB)
+#define JSON_CBOR_MAP_INDEFINITE           (0xBF)
+#define JSON_CBOR_ARRAY_INDEFINITE         (0x9F)
+#define JSON_CBOR_BREAK                    (0xFF)
+
+/* Simple values of major type 7 */
+#define JSON_CBOR_SIMPLE_FALSE             (20)
+#define JSON_CBOR_SIMPLE_TRUE              (21)
+#define JSON_CBOR_SIMPLE_HALF              (25)
+#define JSON_CBOR_SIMPLE_FLOAT             (26)
+#define JSON_CBOR_SIMPLE_DOUBLE            (27)
+
+/* Longest decimal integer written by the decoder: 20 digits and a sign */
+#define JSON_CBOR_INTEGER_SIZE             (22)
+
+/* Bytes of a byte string encoded to base64url per call to the JSON writer */
+#define JSON_CBOR_BASE64_CHUNK             (48)
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/* Array or map being decoded */
+typedef struct
+{
+    uint64_t    count;          /* Data items of a definite-length container: elements, or keys and values */
+    uint64_t    items;          /* Data items decoded so far */
+    bool        indefinite;     /* Set for an indefinite-length container, ended by a break */
+    bool        map;            /* Set for a map */
+} json_cbor_level_t;
+
+/* Base64url encoding of a byte string, which may be split in chunks */
+typedef struct
+{
+    uint8_t     carry[ 3 ];     /* Bytes not encoded yet, less than a group of 3 */
+    uint32_t    carried;        /* Number of bytes carried */
+} json_cbor_base64_t;
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+static const char json_cbor_base64url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/* Pass the contents of the buffer to the flush callback, and reuse the buffer */
+static cy_rslt_t json_cbor_flush( cy_JSON_cbor_encoder_t* encoder )
+{
+    cy_rslt_t result;
+
+    if ( encoder->flush == NULL )
+    {
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+    if ( encoder->used == 0 )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result        = encoder->flush( encoder->buffer, encoder->used, encoder->argument );
+    encoder->used = 0;
+
+    return result;
+}
+
+/* Append data to the buffer, flushing it each time it is full */
+static cy_rslt_t json_cbor_put( cy_JSON_cbor_encoder_t* encoder, const void* data, uint32_t length )
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    cy_rslt_t      result;
+    uint32_t       part;
+
+    while ( length > 0 )
+    {
+        if ( encoder->used == encoder->size )
+        {
+            result = json_cbor_flush( encoder );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+        }
+
+        part = encoder->size - encoder->used;
+        part = ( length < part ) ? length : part;
+        memcpy( encoder->buffer + encoder->used, bytes, part );
+        encoder->used  += part;
+        encoder->total += part;
+        bytes          += part;
+        length         -= part;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Write the initial byte of a data item and its argument, in the shortest form */
+static cy_rslt_t json_cbor_put_head( cy_JSON_cbor_encoder_t* encoder, uint8_t major, uint64_t argument )
+{
+    uint8_t  head[ 9 ];
+    uint32_t size;
+    uint32_t i;
+
+    if ( argument < JSON_CBOR_INFO_ONE_BYTE )
+    {
+        head[ 0 ] = (uint8_t)( ( major << 5 ) | argument );
+        return json_cbor_put( encoder, head, 1 );
+    }
+
+    size      = ( argument <= 0xFFUL ) ? 1 : ( ( argument <= 0xFFFFUL ) ? 2 : ( ( argument <= 0xFFFFFFFFUL ) ? 4 : 8 ) );
+    head[ 0 ] = (uint8_t)( ( major << 5 ) | ( ( size == 1 ) ? 24 : ( ( size == 2 ) ? 25 : ( ( size == 4 ) ? 26 : 27 ) ) ) );
+    for ( i = size; i > 0; i-- )
+    {
+        head[ i ]  = (uint8_t)argument;
+        argument >>= 8;
+    }
+
+    return json_cbor_put( encoder, head, size + 1 );
+}
+
+/* Decode the escape sequence starting string, or the two \u escapes of a surrogate pair. Returns its length in the input */
+static uint32_t json_cbor_unescape( const char* string, const char* end, char* decoded, uint32_t* decoded_length )
+{
+    uint32_t length = ( string[ 1 ] == 'u' ) ? 6 : 2;
+
+    /* Two \u escapes only decode to a 4-byte UTF-8 sequence when they form a surrogate pair */
+    if ( ( length == 6 ) && ( end - string >= 12 ) && ( string[ 6 ] == '\\' ) && ( string[ 7 ] == 'u' ) &&
+         ( cy_JSON_unescape( string, 12, decoded, 6, decoded_length ) == CY_RSLT_SUCCESS ) && ( *decoded_length == 4 ) && ( (uint8_t)decoded[ 0 ] >= 0xF0 ) )
+    {
+        return 12;
+    }
+
+    if ( cy_JSON_unescape( string, length, decoded, 6, decoded_length ) != CY_RSLT_SUCCESS )
+    {
+        *decoded_length = 0;
+    }
+
+    return length;
+}
+
+/* Write a member name or a string value as a text string, with its escape sequences decoded */
+static cy_rslt_t json_cbor_put_text( cy_JSON_cbor_encoder_t* encoder, const char* string, uint32_t length )
+{
+    cy_rslt_t   result;
+    const char* end = string + length;
+    const char* position;
+    const char* escape;
+    char        decoded[ 6 ];
+    uint32_t    decoded_length;
+    uint64_t    total = 0;
+
+    if ( memchr( string, '\\', length ) == NULL )
+    {
+        result = json_cbor_put_head( encoder, JSON_CBOR_TEXT, length );
+        return ( result == CY_RSLT_SUCCESS ) ? json_cbor_put( encoder, string, length ) : result;
+    }
+
+    /* The length of the decoded string comes first */
+    for ( position = string; position < end; )
+    {
+        escape    = memchr( position, '\\', (size_t)( end - position ) );
+        escape    = ( escape != NULL ) ? escape : end;
+        total    += (uint64_t)( escape - position );
+        position  = escape;
+        if ( position < end )
+        {
+            position += json_cbor_unescape( position, end, decoded, &decoded_length );
+            total    += decoded_length;
+        }
+    }
+
+    result = json_cbor_put_head( encoder, JSON_CBOR_TEXT, total );
+    for ( position = string; ( result == CY_RSLT_SUCCESS ) && ( position < end ); )
+    {
+        escape   = memchr( position, '\\', (size_t)( end - position ) );
+        escape   = ( escape != NULL ) ? escape : end;
+        result   = json_cbor_put( encoder, position, (uint32_t)( escape - position ) );
+        position = escape;
+        if ( ( result == CY_RSLT_SUCCESS ) && ( position < end ) )
+        {
+            position += json_cbor_unescape( position, end, decoded, &decoded_length );
+            result    = json_cbor_put( encoder, decoded, decoded_length );
+        }
+    }
+
+    return result;
+}
+
+/* Write a JSON number as an integer when it is one and fits, as a float otherwise */
+static cy_rslt_t json_cbor_put_number( cy_JSON_cbor_encoder_t* encoder, cy_JSON_parser_ctx_t* ctx, cy_JSON_object_t* json_object )
+{
+    const cy_JSON_number_t* number = &ctx->number;
+    uint8_t                 bytes[ 9 ];
+    uint64_t                bits;
+    float                   single;
+    uint32_t                i;
+
+    cy_json_parser_convert_number( ctx, json_object );
+
+    /* Fractions, exponents and digits dropped from the mantissa do not make an exact integer */
+    if ( ( json_object->value_type == JSON_NUMBER_TYPE ) && ( number->exponent == 0 ) )
+    {
+        if ( number->negative && ( number->mantissa != 0 ) )
+        {
+            return json_cbor_put_head( encoder, JSON_CBOR_NEGATIVE, number->mantissa - 1 );
+        }
+        return json_cbor_put_head( encoder, JSON_CBOR_UNSIGNED, number->mantissa );
+    }
+
+    single = (float)json_object->doubleval;
+    if ( (double)single == json_object->doubleval )
+    {
+        memcpy( &i, &single, sizeof( i ) );
+        bits      = i;
+        bytes[ 0 ] = JSON_CBOR_FLOAT;
+        for ( i = 4; i > 0; i-- )
+        {
+            bytes[ i ] = (uint8_t)bits;
+            bits     >>= 8;
+        }
+        return json_cbor_put( encoder, bytes, 5 );
+    }
+
+    memcpy( &bits, &json_object->doubleval, sizeof( bits ) );
+    bytes[ 0 ] = JSON_CBOR_DOUBLE;
+    for ( i = 8; i > 0; i-- )
+    {
+        bytes[ i ] = (uint8_t)bits;
+        bits     >>= 8;
+    }
+
+    return json_cbor_put( encoder, bytes, 9 );
+}
+
+/* Encode the parse events: member names, values, and the start and end of objects and arrays */
+static cy_rslt_t json_cbor_event( struct cy_JSON_parser_ctx* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg )
+{
+    cy_JSON_cbor_encoder_t* encoder = (cy_JSON_cbor_encoder_t*)arg;
+    cy_rslt_t               result  = CY_RSLT_SUCCESS;
+    uint8_t                 initial;
+
+    /* The member name of a value, an object or an array is pending until it is reported */
+    if ( ( event != CY_JSON_EVENT_CONTAINER_END ) && ( ctx->key != NULL ) )
+    {
+        result = json_cbor_put_text( encoder, ctx->key, ctx->key_length );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+    }
+
+    switch ( event )
+    {
+        case CY_JSON_EVENT_CONTAINER_START:
+            initial = ( json_object->value[ 0 ] == '{' ) ? JSON_CBOR_MAP_INDEFINITE : JSON_CBOR_ARRAY_INDEFINITE;
+            encoder->depth++;
+            return json_cbor_put( encoder, &initial, 1 );
+
+        case CY_JSON_EVENT_CONTAINER_END:
+            initial = JSON_CBOR_BREAK;
+            encoder->depth--;
+            return json_cbor_put( encoder, &initial, 1 );
+
+        default:
+            break;
+    }
+
+    switch ( json_object->value_type )
+    {
+        case JSON_STRING_TYPE:
+            return json_cbor_put_text( encoder, json_object->value, ctx->value_length );
+
+        case JSON_NUMBER_TYPE:
+            return json_cbor_put_number( encoder, ctx, json_object );
+
+        case JSON_BOOLEAN_TYPE:
+            initial = ( json_object->value[ 0 ] == 't' ) ? JSON_CBOR_TRUE : JSON_CBOR_FALSE;
+            return json_cbor_put( encoder, &initial, 1 );
+
+        default:
+            initial = JSON_CBOR_NULL;
+            return json_cbor_put( encoder, &initial, 1 );
+    }
+}
+
+/* Read the initial byte of a data item and its argument */
+static cy_rslt_t json_cbor_get_head( const uint8_t* cbor, uint32_t length, uint32_t* position, uint8_t* major, uint8_t* info, uint64_t* argument )
+{
+    uint32_t size;
+    uint32_t i;
+
+    if ( *position >= length )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    *major    = (uint8_t)( cbor[ *position ] >> 5 );
+    *info     = (uint8_t)( cbor[ *position ] & 0x1F );
+    *argument = *info;
+    ( *position )++;
+
+    if ( *info < JSON_CBOR_INFO_ONE_BYTE )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+    if ( *info == JSON_CBOR_INFO_INDEFINITE )
+    {
+        /* Only strings, arrays and maps have indefinite lengths. A break outside of them is malformed */
+        return ( ( *major >= JSON_CBOR_BYTES ) && ( *major <= JSON_CBOR_MAP ) ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_GENERIC_ERROR;
+    }
+    if ( *info > JSON_CBOR_SIMPLE_DOUBLE )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    size = 1U << ( *info - JSON_CBOR_INFO_ONE_BYTE );
+    if ( length - *position < size )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    *argument = 0;
+    for ( i = 0; i < size; i++ )
+    {
+        *argument = ( *argument << 8 ) | cbor[ ( *position )++ ];
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Format an integer of major type 0 or 1 in decimal. Returns the start of the text, which ends at text + JSON_CBOR_INTEGER_SIZE */
+static char* json_cbor_integer_text( uint8_t major, uint64_t argument, char* text )
+{
+    char* digit = text + JSON_CBOR_INTEGER_SIZE;
+    char* last  = digit - 1;
+    char* carry;
+
+    do
+    {
+        *--digit   = (char)( '0' + ( argument % 10 ) );
+        argument  /= 10;
+    } while ( argument != 0 );
+
+    if ( major == JSON_CBOR_NEGATIVE )
+    {
+        /* The value is -1 - argument: add one to the decimal digits, which cannot overflow 64 bits here */
+        for ( carry = last; ( carry >= digit ) && ( *carry == '9' ); carry-- )
+        {
+            *carry = '0';
+        }
+        if ( carry < digit )
+        {
+            *--digit = '1';
+        }
+        else
+        {
+            ( *carry )++;
+        }
+        *--digit = '-';
+    }
+
+    return digit;
+}
+
+/* Encode bytes to base64url, written as parts of a JSON string. The last call writes the rest and closes the string */
+static cy_rslt_t json_cbor_base64( cy_JSON_writer_t* writer, json_cbor_base64_t* base64, const uint8_t* data, uint32_t length, bool last )
+{
+    char     text[ JSON_CBOR_BASE64_CHUNK / 3 * 4 ];
+    uint32_t used = 0;
+    uint32_t group;
+    uint32_t i;
+
+    while ( ( length > 0 ) || last )
+    {
+        while ( ( length > 0 ) && ( base64->carried < 3 ) )
+        {
+            base64->carry[ base64->carried++ ] = *data++;
+            length--;
+        }
+
+        if ( ( base64->carried == 3 ) || ( last && ( length == 0 ) && ( base64->carried > 0 ) ) )
+        {
+            group = ( (uint32_t)base64->carry[ 0 ] << 16 ) | ( ( base64->carried > 1 ) ? ( (uint32_t)base64->carry[ 1 ] << 8 ) : 0 ) |
+                    ( ( base64->carried > 2 ) ? base64->carry[ 2 ] : 0 );
+            for ( i = 0; i <= base64->carried; i++ )
+            {
+                text[ used++ ] = json_cbor_base64url[ ( group >> ( 18 - ( 6 * i ) ) ) & 0x3F ];
+            }
+            base64->carried = 0;
+        }
+
+        if ( ( used == sizeof( text ) ) || ( length == 0 ) )
+        {
+            if ( ( cy_JSON_writer_string_part( writer, text, used, last && ( length == 0 ) && ( base64->carried == 0 ) ) ) != CY_RSLT_SUCCESS )
+            {
+                return writer->result;
+            }
+            used = 0;
+            if ( length == 0 )
+            {
+                break;
+            }
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Write a byte or text string, of definite or indefinite length, as a JSON string */
+static cy_rslt_t json_cbor_string( const uint8_t* cbor, uint32_t length, uint32_t* position, uint8_t major, uint8_t info, uint64_t argument, cy_JSON_writer_t* writer )
+{
+    json_cbor_base64_t base64 = { { 0 }, 0 };
+    cy_rslt_t          result;
+    uint8_t            chunk_major;
+    uint8_t            chunk_info;
+    bool               last = ( info != JSON_CBOR_INFO_INDEFINITE );
+
+    /* An indefinite-length string is a sequence of definite-length strings of the same major type, ended by a break */
+    do
+    {
+        if ( !last )
+        {
+            if ( *position >= length )
+            {
+                return CY_RSLT_JSON_INCOMPLETE;
+            }
+            if ( cbor[ *position ] == JSON_CBOR_BREAK )
+            {
+                ( *position )++;
+                last     = true;
+                argument = 0;
+            }
+            else
+            {
+                result = json_cbor_get_head( cbor, length, position, &chunk_major, &chunk_info, &argument );
+                if ( result != CY_RSLT_SUCCESS )
+                {
+                    return result;
+                }
+                if ( ( chunk_major != major ) || ( chunk_info == JSON_CBOR_INFO_INDEFINITE ) )
+                {
+                    return CY_RSLT_JSON_GENERIC_ERROR;
+                }
+            }
+        }
+
+        if ( argument > length - *position )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+
+        if ( major == JSON_CBOR_BYTES )
+        {
+            result = json_cbor_base64( writer, &base64, cbor + *position, (uint32_t)argument, last );
+        }
+        else if ( last && ( info != JSON_CBOR_INFO_INDEFINITE ) )
+        {
+            result = cy_JSON_writer_string( writer, (const char*)cbor + *position, (uint32_t)argument );
+        }
+        else
+        {
+            result = cy_JSON_writer_string_part( writer, (const char*)cbor + *position, (uint32_t)argument, last );
+        }
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        *position += (uint32_t)argument;
+    } while ( !last );
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Write a float of major type 7 as a number, or as null if it is infinite or NaN */
+static cy_rslt_t json_cbor_float( uint8_t info, uint64_t argument, cy_JSON_writer_t* writer )
+{
+    double   value;
+    float    single;
+    uint32_t bits;
+    int      exponent;
+
+    if ( info == JSON_CBOR_SIMPLE_HALF )
+    {
+        exponent = (int)( ( argument >> 10 ) & 0x1F );
+        value    = ( exponent == 0 ) ? ldexp( (double)( argument & 0x3FF ), -24 ) :
+                   ( ( exponent == 0x1F ) ? ( ( ( argument & 0x3FF ) == 0 ) ? INFINITY : NAN ) : ldexp( (double)( ( argument & 0x3FF ) | 0x400 ), exponent - 25 ) );
+        value    = ( ( argument & 0x8000 ) != 0 ) ? -value : value;
+    }
+    else if ( info == JSON_CBOR_SIMPLE_FLOAT )
+    {
+        bits = (uint32_t)argument;
+        memcpy( &single, &bits, sizeof( single ) );
+        value = single;
+    }
+    else
+    {
+        memcpy( &value, &argument, sizeof( value ) );
+    }
+
+    return isfinite( value ) ? cy_JSON_writer_double( writer, value ) : cy_JSON_writer_null( writer );
+}
+
+
+cy_rslt_t cy_JSON_cbor_encoder_init( cy_JSON_cbor_encoder_t* encoder, uint8_t* buffer, uint32_t size, cy_JSON_cbor_flush_t flush, void* arg )
+{
+    if ( ( encoder == NULL ) || ( buffer == NULL ) || ( size == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( encoder, 0x0, sizeof( *encoder ) );
+    encoder->buffer   = buffer;
+    encoder->size     = size;
+    encoder->flush    = flush;
+    encoder->argument = arg;
+
+    cy_JSON_parser_ctx_init( &encoder->parser );
+    cy_json_parser_set_event_handler( &encoder->parser, json_cbor_event, encoder );
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cbor_encode( cy_JSON_cbor_encoder_t* encoder, const char* json_input, uint32_t input_length )
+{
+    cy_rslt_t result;
+
+    if ( ( encoder == NULL ) || ( ( json_input == NULL ) && ( input_length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( encoder->result != CY_RSLT_SUCCESS )
+    {
+        return encoder->result;
+    }
+
+    result = cy_JSON_parser_ctx_parse( &encoder->parser, json_input, input_length );
+    if ( ( result != CY_RSLT_SUCCESS ) && ( result != CY_RSLT_JSON_INCOMPLETE ) )
+    {
+        encoder->result = result;
+    }
+
+    return result;
+}
+
+
+cy_rslt_t cy_JSON_cbor_encoder_finish( cy_JSON_cbor_encoder_t* encoder, uint32_t* length )
+{
+    cy_rslt_t result;
+
+    if ( encoder == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( encoder->result != CY_RSLT_SUCCESS )
+    {
+        return encoder->result;
+    }
+    if ( ( encoder->depth != 0 ) || ( encoder->total == 0 ) )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    if ( encoder->flush != NULL )
+    {
+        result = json_cbor_flush( encoder );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            encoder->result = result;
+            return result;
+        }
+    }
+
+    if ( length != NULL )
+    {
+        *length = encoder->total;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cbor_to_json( const uint8_t* cbor, uint32_t length, cy_JSON_writer_t* writer, uint32_t* consumed )
+{
+    json_cbor_level_t  levels[ CY_JSON_WRITER_MAX_DEPTH ];
+    json_cbor_level_t* level;
+    cy_rslt_t          result;
+    char               text[ JSON_CBOR_INTEGER_SIZE ];
+    char*              integer;
+    uint32_t           position = 0;
+    uint32_t           depth    = 0;
+    uint64_t           argument;
+    uint8_t            major;
+    uint8_t            info;
+
+    if ( ( cbor == NULL ) || ( writer == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    do
+    {
+        level = ( depth > 0 ) ? &levels[ depth - 1 ] : NULL;
+
+        if ( ( level != NULL ) && level->indefinite && ( position < length ) && ( cbor[ position ] == JSON_CBOR_BREAK ) )
+        {
+            /* A map cannot end between a key and its value */
+            if ( level->map && ( ( level->items % 2 ) != 0 ) )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            position++;
+            result = ( level->map ) ? cy_JSON_writer_end_object( writer ) : cy_JSON_writer_end_array( writer );
+            depth--;
+        }
+        else
+        {
+            /* Tags are dropped: the tagged data item follows */
+            do
+            {
+                result = json_cbor_get_head( cbor, length, &position, &major, &info, &argument );
+                if ( result != CY_RSLT_SUCCESS )
+                {
+                    return result;
+                }
+            } while ( major == JSON_CBOR_TAG );
+
+            if ( ( level != NULL ) && level->map && ( ( level->items % 2 ) == 0 ) )
+            {
+                /* Map key */
+                if ( ( major == JSON_CBOR_UNSIGNED ) || ( major == JSON_CBOR_NEGATIVE ) )
+                {
+                    integer = json_cbor_integer_text( major, argument, text );
+                    result  = cy_JSON_writer_key( writer, integer, (uint32_t)( text + sizeof( text ) - integer ) );
+                }
+                else if ( ( major == JSON_CBOR_TEXT ) && ( info != JSON_CBOR_INFO_INDEFINITE ) )
+                {
+                    if ( argument > length - position )
+                    {
+                        return CY_RSLT_JSON_INCOMPLETE;
+                    }
+                    result    = cy_JSON_writer_key( writer, (const char*)cbor + position, (uint32_t)argument );
+                    position += (uint32_t)argument;
+                }
+                else
+                {
+                    return CY_RSLT_JSON_TYPE_MISMATCH;
+                }
+            }
+            else
+            {
+                switch ( major )
+                {
+                    case JSON_CBOR_UNSIGNED:
+                        result = cy_JSON_writer_uint64( writer, argument );
+                        break;
+
+                    case JSON_CBOR_NEGATIVE:
+                        integer = json_cbor_integer_text( major, argument, text );
+                        result  = cy_JSON_writer_number( writer, integer, (uint32_t)( text + sizeof( text ) - integer ) );
+                        break;
+
+                    case JSON_CBOR_BYTES:
+                    case JSON_CBOR_TEXT:
+                        result = json_cbor_string( cbor, length, &position, major, info, argument, writer );
+                        break;
+
+                    case JSON_CBOR_ARRAY:
+                    case JSON_CBOR_MAP:
+                        if ( depth >= CY_JSON_WRITER_MAX_DEPTH )
+                        {
+                            return CY_RSLT_JSON_DEPTH_EXCEEDED;
+                        }
+                        result = ( major == JSON_CBOR_MAP ) ? cy_JSON_writer_begin_object( writer ) : cy_JSON_writer_begin_array( writer );
+                        if ( result != CY_RSLT_SUCCESS )
+                        {
+                            return result;
+                        }
+
+                        if ( ( info == JSON_CBOR_INFO_INDEFINITE ) || ( argument != 0 ) )
+                        {
+                            level             = &levels[ depth++ ];
+                            level->indefinite = ( info == JSON_CBOR_INFO_INDEFINITE );
+                            level->map        = ( major == JSON_CBOR_MAP );
+                            level->count      = ( level->map ) ? ( argument * 2 ) : argument;
+                            level->items      = 0;
+                            continue;
+                        }
+
+                        /* Empty container */
+                        result = ( major == JSON_CBOR_MAP ) ? cy_JSON_writer_end_object( writer ) : cy_JSON_writer_end_array( writer );
+                        break;
+
+                    default:
+                        if ( ( info >= JSON_CBOR_SIMPLE_HALF ) && ( info <= JSON_CBOR_SIMPLE_DOUBLE ) )
+                        {
+                            result = json_cbor_float( info, argument, writer );
+                        }
+                        else if ( ( argument == JSON_CBOR_SIMPLE_FALSE ) || ( argument == JSON_CBOR_SIMPLE_TRUE ) )
+                        {
+                            result = cy_JSON_writer_bool( writer, ( argument == JSON_CBOR_SIMPLE_TRUE ) );
+                        }
+                        else
+                        {
+                            result = cy_JSON_writer_null( writer );
+                        }
+                        break;
+                }
+            }
+        }
+
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+
+        /* The data item is complete: count it in its container, and close the definite-length containers it completes */
+        while ( depth > 0 )
+        {
+            level = &levels[ depth - 1 ];
+            level->items++;
+            if ( level->indefinite || ( level->items < level->count ) )
+            {
+                break;
+            }
+            result = ( level->map ) ? cy_JSON_writer_end_object( writer ) : cy_JSON_writer_end_array( writer );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            depth--;
+        }
+    } while ( depth > 0 );
+
+    if ( consumed != NULL )
+    {
+        *consumed = position;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * The JSON CBOR utility transcodes JSON documents to CBOR (RFC 8949), and CBOR data items back to JSON.
+ *
+ * The encoder parses the JSON data with a JSON parser context, as it is received, and writes the CBOR data item of each
+ * JSON document into a buffer provided by the application, without heap allocation. When the buffer is full, its contents
+ * are passed to the flush callback of the application, for instance to send them over the network, and the buffer is
+ * reused. Objects and arrays are encoded with indefinite lengths, strings with their escape sequences decoded, integers
+ * as CBOR integers, and other numbers as single precision floats when exact, double precision otherwise. Consecutive
+ * JSON documents are encoded as a CBOR sequence (RFC 8742).
+ *
+ * The decoder writes a CBOR data item held in memory as a JSON document through a JSON writer, see @ref cy_json_writer.h.
+ *
+ * Example:
+ * @code
+ * cy_JSON_cbor_encoder_t encoder;
+ * uint8_t                buffer[ 128 ];
+ * char                   token_buffer[ 64 ];
+ * uint32_t               length;
+ *
+ * cy_JSON_cbor_encoder_init( &encoder, buffer, sizeof( buffer ), send_telemetry, socket );
+ * cy_JSON_parser_ctx_set_token_buffer( &encoder.parser, token_buffer, sizeof( token_buffer ) );
+ * result = cy_JSON_cbor_encode( &encoder, json_part, json_part_length );
+ * ...
+ * result = cy_JSON_cbor_encoder_finish( &encoder, &length );
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+#include "cy_json_writer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/** Flush callback of the CBOR encoder
+ *
+ * @param[in] data   : Part of the CBOR data encoded so far, which follows the part of the previous call
+ * @param[in] length : Length of the data
+ * @param[in] arg    : User argument passed to @ref cy_JSON_cbor_encoder_init
+ *
+ * @return CY_RSLT_SUCCESS to go on encoding. Any other value stops the encoder, and is returned by all its later calls.
+ */
+typedef cy_rslt_t (*cy_JSON_cbor_flush_t)( const uint8_t* data, uint32_t length, void* arg );
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/** JSON to CBOR encoder. The members are internal to the encoder, except the parser context, on which a token buffer
+ *  can be set to encode JSON documents split across input buffers */
+typedef struct
+{
+    cy_JSON_parser_ctx_t    parser;         /**< Parser context of the JSON data */
+    uint8_t*                buffer;         /**< Buffer provided by the application */
+    uint32_t                size;           /**< Size of the buffer */
+    uint32_t                used;           /**< Bytes of the buffer not flushed yet */
+    uint32_t                total;          /**< Length of the CBOR data encoded so far */
+    cy_JSON_cbor_flush_t    flush;          /**< Flush callback, NULL if there is none */
+    void*                   argument;       /**< User argument of the flush callback */
+    cy_rslt_t               result;         /**< First error, returned by all later calls */
+    uint32_t                depth;          /**< Number of open objects and arrays */
+} cy_JSON_cbor_encoder_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Initialize a JSON to CBOR encoder
+ *
+ * @param[out] encoder : Pointer to the encoder
+ * @param[in]  buffer  : Buffer receiving the CBOR data, which must remain valid while the encoder is in use
+ * @param[in]  size    : Size of the buffer
+ * @param[in]  flush   : Optional flush callback, called whenever the buffer is full and by @ref cy_JSON_cbor_encoder_finish.
+ *                       Without one, CY_RSLT_JSON_BUFFER_OVERFLOW is returned if the CBOR data does not fit in the buffer.
+ * @param[in]  arg     : User argument passed to the flush callback
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cbor_encoder_init( cy_JSON_cbor_encoder_t* encoder, uint8_t* buffer, uint32_t size, cy_JSON_cbor_flush_t flush, void* arg );
+
+/** Encode JSON data to CBOR
+ *
+ * A JSON document split across several input buffers is encoded by calling this function with each buffer in turn,
+ * with a token buffer set on the parser context of the encoder.
+ *
+ * @param[in] encoder      : Pointer to an initialized encoder
+ * @param[in] json_input   : Pointer to the JSON data
+ * @param[in] input_length : Length of the JSON data
+ *
+ * @return on success - CY_RSLT_SUCCESS when the JSON document is complete
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the JSON document continues in the next input buffer
+ *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if the CBOR data does not fit in the buffer, without flush callback
+ *                    - Any error returned by @ref cy_JSON_parser_ctx_parse, or by the flush callback
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cbor_encode( cy_JSON_cbor_encoder_t* encoder, const char* json_input, uint32_t input_length );
+
+/** Complete the CBOR data
+ *
+ * The rest of the CBOR data is passed to the flush callback, if any. Otherwise the CBOR data is in the buffer.
+ * The encoder may then be initialized again.
+ *
+ * @param[in]  encoder : Pointer to an initialized encoder
+ * @param[out] length  : Optional; set to the length of the whole CBOR data
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if no JSON document is complete, or the last one is not
+ *                    - Any error met by the encoder, see @ref cy_JSON_cbor_encode
+ */
+cy_rslt_t cy_JSON_cbor_encoder_finish( cy_JSON_cbor_encoder_t* encoder, uint32_t* length );
+
+/** Write a CBOR data item as a JSON document
+ *
+ * Integers, floats, text strings, arrays, maps, false, true and null are written as their JSON counterparts. Following
+ * RFC 8949 section 6.1, byte strings are written as base64url strings without padding, tags are dropped, and infinite
+ * or NaN floats, undefined and the other simple values are written as null. Map keys must be text strings, or integers
+ * which are written as strings of their decimal value. Strings of indefinite length are supported, except as map keys.
+ *
+ * @param[in]  cbor     : Pointer to the CBOR data
+ * @param[in]  length   : Length of the CBOR data
+ * @param[in]  writer   : Pointer to an initialized JSON writer, completed by the application with @ref cy_JSON_writer_finish
+ * @param[out] consumed : Optional; set to the length of the data item, after which the next item of a CBOR sequence starts
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the data item is truncated
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the CBOR data is malformed
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if a map key is neither a text string nor an integer
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if arrays and maps are nested deeper than CY_JSON_WRITER_MAX_DEPTH
+ *                    - Any error returned by the JSON writer
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cbor_to_json( const uint8_t* cbor, uint32_t length, cy_JSON_writer_t* writer, uint32_t* consumed );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
@@ -0,0 +1,448 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_cursor.h"
+#include "cy_json_parser_private.h"
+#include <stddef.h>
+#include <string.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/* Make each event the current token, and pause the parse until the application asks for the next one */
+static cy_rslt_t json_cursor_event( cy_JSON_parser_ctx_t* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg )
+{
+    cy_JSON_cursor_t*       cursor = (cy_JSON_cursor_t*)arg;
+    cy_JSON_parser_level_t* level;
+
+    cursor->type         = json_object->value_type;
+    cursor->value        = json_object->value;
+    cursor->value_length = ctx->value_length;
+    cursor->key          = ctx->key;
+    cursor->key_length   = ctx->key_length;
+    cursor->converted    = false;
+
+    switch ( event )
+    {
+        case CY_JSON_EVENT_VALUE:
+            cursor->token = CY_JSON_TOKEN_VALUE;
+            break;
+
+        case CY_JSON_EVENT_CONTAINER_START:
+            cursor->token        = ( json_object->value_type == JSON_OBJECT_TYPE ) ? CY_JSON_TOKEN_OBJECT_START : CY_JSON_TOKEN_ARRAY_START;
+            cursor->value_length = 1;
+            break;
+
+        case CY_JSON_EVENT_CONTAINER_END:
+        default:
+            level                = &ctx->levels[ ctx->depth - 1 ];
+            cursor->token        = ( json_object->value_type == JSON_OBJECT_TYPE ) ? CY_JSON_TOKEN_OBJECT_END : CY_JSON_TOKEN_ARRAY_END;
+            cursor->key          = level->record.object_string;
+            cursor->key_length   = level->name_length;
+            cursor->value_length = 1;
+
+            /* Nothing is read after the document root */
+            cursor->complete     = ( ctx->depth == 1 );
+            break;
+    }
+
+    cy_json_parser_pause( ctx );
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Convert the current number on first use. The parser keeps its digits until the next token is parsed */
+static cy_rslt_t json_cursor_number( cy_JSON_cursor_t* cursor )
+{
+    cy_JSON_object_t* json_object = &cursor->parser.json_object;
+
+    if ( ( cursor->token != CY_JSON_TOKEN_VALUE ) || ( cursor->type != JSON_NUMBER_TYPE ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    if ( !cursor->converted )
+    {
+        cy_json_parser_convert_number( &cursor->parser, json_object );
+        cursor->converted = true;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_init( cy_JSON_cursor_t* cursor, const char* json_input, uint32_t input_length )
+{
+    if ( ( cursor == NULL ) || ( ( json_input == NULL ) && ( input_length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( cursor, 0x0, sizeof( *cursor ) );
+
+    cy_JSON_parser_ctx_init( &cursor->parser );
+    cy_json_parser_set_event_handler( &cursor->parser, json_cursor_event, cursor );
+
+    cursor->json_input   = json_input;
+    cursor->input_length = input_length;
+    cursor->result       = CY_RSLT_SUCCESS;
+    cursor->token        = CY_JSON_TOKEN_NONE;
+    cursor->type         = UNKNOWN_JSON_TYPE;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_next( cy_JSON_cursor_t* cursor, cy_JSON_token_t* token )
+{
+    cy_rslt_t result;
+    uint32_t  consumed;
+
+    if ( cursor == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( cursor->result != CY_RSLT_SUCCESS )
+    {
+        return cursor->result;
+    }
+
+    if ( cursor->complete )
+    {
+        cursor->token = CY_JSON_TOKEN_END;
+        cursor->type  = UNKNOWN_JSON_TYPE;
+        cursor->key   = NULL;
+    }
+    else
+    {
+        result = cy_json_parser_resume( &cursor->parser, cursor->json_input + cursor->position, cursor->input_length - cursor->position, &consumed );
+        if ( result != CY_JSON_EVENT_RSLT_PAUSED )
+        {
+            /* The input ended before the next token. Without a token buffer, the parser cannot keep a partial token */
+            if ( ( result == CY_RSLT_SUCCESS ) || ( result == CY_RSLT_JSON_BUFFER_OVERFLOW ) )
+            {
+                result = CY_RSLT_JSON_INCOMPLETE;
+            }
+            cursor->result = result;
+            cursor->token  = CY_JSON_TOKEN_NONE;
+            return result;
+        }
+        cursor->position += consumed;
+    }
+
+    if ( token != NULL )
+    {
+        *token = (cy_JSON_token_t)cursor->token;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_key( cy_JSON_cursor_t* cursor, const char** key, uint32_t* key_length )
+{
+    if ( ( cursor == NULL ) || ( key == NULL ) || ( key_length == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( ( cursor->token == CY_JSON_TOKEN_NONE ) || ( cursor->token == CY_JSON_TOKEN_END ) || ( cursor->key == NULL ) )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    *key        = cursor->key;
+    *key_length = cursor->key_length;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_JSON_type_t cy_JSON_cursor_get_type( cy_JSON_cursor_t* cursor )
+{
+    if ( ( cursor == NULL ) || ( cursor->token == CY_JSON_TOKEN_NONE ) || ( cursor->token == CY_JSON_TOKEN_END ) )
+    {
+        return UNKNOWN_JSON_TYPE;
+    }
+
+    return cursor->type;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_string( cy_JSON_cursor_t* cursor, const char** value, uint32_t* length )
+{
+    if ( ( cursor == NULL ) || ( value == NULL ) || ( length == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( ( cursor->token != CY_JSON_TOKEN_VALUE ) || ( cursor->type != JSON_STRING_TYPE ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *value  = cursor->value;
+    *length = cursor->value_length;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_int64( cy_JSON_cursor_t* cursor, int64_t* value )
+{
+    const cy_JSON_number_t* number;
+
+    if ( ( cursor == NULL ) || ( value == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( json_cursor_number( cursor ) != CY_RSLT_SUCCESS )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    /* Fractions, exponents and digits dropped from the mantissa do not make an exact integer */
+    number = &cursor->parser.number;
+    if ( ( cursor->parser.json_object.value_type != JSON_NUMBER_TYPE ) || ( number->exponent != 0 ) ||
+         ( number->mantissa > ( ( number->negative ) ? ( (uint64_t)INT64_MAX + 1 ) : (uint64_t)INT64_MAX ) ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *value = cursor->parser.json_object.int64val;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_uint64( cy_JSON_cursor_t* cursor, uint64_t* value )
+{
+    const cy_JSON_number_t* number;
+
+    if ( ( cursor == NULL ) || ( value == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( json_cursor_number( cursor ) != CY_RSLT_SUCCESS )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    number = &cursor->parser.number;
+    if ( ( cursor->parser.json_object.value_type != JSON_NUMBER_TYPE ) || ( number->exponent != 0 ) ||
+         ( number->negative && ( number->mantissa != 0 ) ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *value = cursor->parser.json_object.uint64val;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_double( cy_JSON_cursor_t* cursor, double* value )
+{
+    if ( ( cursor == NULL ) || ( value == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( json_cursor_number( cursor ) != CY_RSLT_SUCCESS )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *value = cursor->parser.json_object.doubleval;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_get_bool( cy_JSON_cursor_t* cursor, bool* value )
+{
+    if ( ( cursor == NULL ) || ( value == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( ( cursor->token != CY_JSON_TOKEN_VALUE ) || ( cursor->type != JSON_BOOLEAN_TYPE ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *value = ( cursor->value[ 0 ] == TRUE_TOKEN );
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_enter( cy_JSON_cursor_t* cursor )
+{
+    if ( cursor == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* The parser opened the container when it read its start: its contents come next */
+    if ( ( cursor->token != CY_JSON_TOKEN_OBJECT_START ) && ( cursor->token != CY_JSON_TOKEN_ARRAY_START ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_leave( cy_JSON_cursor_t* cursor )
+{
+    if ( cursor == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( cursor->complete || ( cursor->result != CY_RSLT_SUCCESS ) || ( cursor->parser.depth == 0 ) )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    /* The rest of the document root is not needed, so it is not even scanned */
+    if ( cursor->parser.depth == 1 )
+    {
+        cursor->complete = true;
+    }
+    else
+    {
+        cy_json_parser_skip_container( &cursor->parser );
+    }
+
+    cursor->token = CY_JSON_TOKEN_NONE;
+    cursor->type  = UNKNOWN_JSON_TYPE;
+    cursor->key   = NULL;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_skip( cy_JSON_cursor_t* cursor )
+{
+    if ( cursor == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( ( cursor->token == CY_JSON_TOKEN_OBJECT_START ) || ( cursor->token == CY_JSON_TOKEN_ARRAY_START ) )
+    {
+        return cy_JSON_cursor_leave( cursor );
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_cursor_find_member( cy_JSON_cursor_t* cursor, const char* key, uint32_t key_length )
+{
+    cy_rslt_t       result;
+    cy_JSON_token_t token;
+
+    if ( ( cursor == NULL ) || ( key == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( cursor->result != CY_RSLT_SUCCESS )
+    {
+        return cursor->result;
+    }
+
+    if ( cursor->complete || ( cursor->parser.depth == 0 ) || ( cursor->parser.levels[ cursor->parser.depth - 1 ].container != OBJECT_START_TOKEN ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    while ( true )
+    {
+        result = cy_JSON_cursor_next( cursor, &token );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+
+        /* The contents of the other members are skipped, so the first end is the end of the object */
+        if ( ( token == CY_JSON_TOKEN_OBJECT_END ) || ( token == CY_JSON_TOKEN_END ) )
+        {
+            return CY_RSLT_JSON_NOT_FOUND;
+        }
+
+        if ( ( cursor->key_length == key_length ) && ( memcmp( cursor->key, key, key_length ) == 0 ) )
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        cy_JSON_cursor_skip( cursor );
+    }
+}
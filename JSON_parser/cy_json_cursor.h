@@ -0,0 +1,316 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/**
+ * @file
+ * The JSON cursor utility lets the application pull the tokens of a JSON document one at a time, instead of receiving
+ * them through a callback.
+ *
+ * The document is only parsed as far as the application reads it: once the member it needs has been read, the rest of
+ * the document is left unparsed. Objects and arrays which are not needed are skipped without parsing their contents.
+ * The cursor uses the same parser as @ref cy_JSON_parser_ctx_parse, and the document must be held in a single buffer.
+ *
+ * Example:
+ * @code
+ * cy_JSON_cursor_t cursor;
+ * int64_t          id;
+ *
+ * cy_JSON_cursor_init( &cursor, json_input, input_length );
+ * if ( ( cy_JSON_cursor_next( &cursor, NULL ) == CY_RSLT_SUCCESS ) &&
+ *      ( cy_JSON_cursor_enter( &cursor ) == CY_RSLT_SUCCESS ) &&
+ *      ( cy_JSON_cursor_find_member( &cursor, "id", 2 ) == CY_RSLT_SUCCESS ) )
+ * {
+ *     result = cy_JSON_cursor_get_int64( &cursor, &id );
+ * }
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_enums
+ *//** \{ */
+/******************************************************************************/
+
+/** Tokens returned by the JSON cursor */
+typedef enum
+{
+    CY_JSON_TOKEN_NONE,          /**< No current token: before the first token, or after a skipped object or array */
+    CY_JSON_TOKEN_VALUE,         /**< String, number, boolean or null */
+    CY_JSON_TOKEN_OBJECT_START,  /**< Start of an object */
+    CY_JSON_TOKEN_OBJECT_END,    /**< End of an object */
+    CY_JSON_TOKEN_ARRAY_START,   /**< Start of an array */
+    CY_JSON_TOKEN_ARRAY_END,     /**< End of an array */
+    CY_JSON_TOKEN_END            /**< End of the JSON document */
+} cy_JSON_token_t;
+
+/** \} */
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/** JSON cursor. The members are internal to the JSON cursor and must not be accessed directly by the application,
+ *  except for `parser`, whose stack can be set with @ref cy_JSON_parser_ctx_set_stack after @ref cy_JSON_cursor_init.
+ */
+typedef struct
+{
+    cy_JSON_parser_ctx_t    parser;         /**< Parser context */
+    const char*             json_input;     /**< JSON document */
+    uint32_t                input_length;   /**< Length of the JSON document */
+    uint32_t                position;       /**< Offset in the JSON document where parsing resumes */
+    cy_rslt_t               result;         /**< Error which stopped the parse, returned until the cursor is initialized again */
+    uint8_t                 token;          /**< @ref cy_JSON_token_t of the current token */
+    bool                    complete;       /**< Set once the document root has been read or skipped */
+    bool                    converted;      /**< Set once the current number has been converted */
+    cy_JSON_type_t          type;           /**< Type of the current value */
+    const char*             key;            /**< Member name of the current token, NULL if it has none */
+    uint32_t                key_length;     /**< Length of the member name */
+    const char*             value;          /**< Current value, as it appears in the JSON document */
+    uint32_t                value_length;   /**< Length of the current value */
+} cy_JSON_cursor_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Initialize a JSON cursor before the first token of a JSON document
+ *
+ * The document is not copied, and must stay unchanged while the cursor is used.
+ *
+ * @param[out] cursor       : Pointer to the JSON cursor
+ * @param[in]  json_input   : Pointer to the JSON document
+ * @param[in]  input_length : Length of the JSON document
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_init( cy_JSON_cursor_t* cursor, const char* json_input, uint32_t input_length );
+
+/** Move the cursor to the next token of the JSON document
+ *
+ * Only the input up to the end of the next token is parsed. Once the end of the document root has been read,
+ * CY_JSON_TOKEN_END is returned, and anything after it is ignored.
+ *
+ * @param[in]  cursor : Pointer to an initialized JSON cursor
+ * @param[out] token  : Optional; set to the @ref cy_JSON_token_t of the new current token
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the JSON document is truncated
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than the parser stack
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_next( cy_JSON_cursor_t* cursor, cy_JSON_token_t* token );
+
+/** Get the member name of the current value, object or array
+ *
+ * The name is returned as it appears in the JSON document.
+ *
+ * @param[in]  cursor     : Pointer to a JSON cursor
+ * @param[out] key        : Set to the member name, which is not NUL terminated
+ * @param[out] key_length : Set to the length of the member name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the current token is not a member of an object
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_key( cy_JSON_cursor_t* cursor, const char** key, uint32_t* key_length );
+
+/** Get the type of the current value
+ *
+ * @param[in] cursor : Pointer to a JSON cursor
+ *
+ * @return JSON_STRING_TYPE, JSON_NUMBER_TYPE, JSON_BOOLEAN_TYPE or JSON_NULL_TYPE for a value, JSON_OBJECT_TYPE or
+ *         JSON_ARRAY_TYPE for the start or the end of a container, UNKNOWN_JSON_TYPE otherwise
+ */
+cy_JSON_type_t cy_JSON_cursor_get_type( cy_JSON_cursor_t* cursor );
+
+/** Get the current value as a string
+ *
+ * The string is returned as it appears in the JSON document, between the quotes.
+ *
+ * @param[in]  cursor : Pointer to a JSON cursor
+ * @param[out] value  : Set to the string, which is not NUL terminated
+ * @param[out] length : Set to the length of the string
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not a string
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_string( cy_JSON_cursor_t* cursor, const char** value, uint32_t* length );
+
+/** Get the current value as a signed 64-bit integer
+ *
+ * @param[in]  cursor : Pointer to a JSON cursor
+ * @param[out] value  : Set to the value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not an integer number, or does not fit in 64 bits
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_int64( cy_JSON_cursor_t* cursor, int64_t* value );
+
+/** Get the current value as an unsigned 64-bit integer
+ *
+ * @param[in]  cursor : Pointer to a JSON cursor
+ * @param[out] value  : Set to the value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not a non-negative integer number, or does not fit in 64 bits
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_uint64( cy_JSON_cursor_t* cursor, uint64_t* value );
+
+/** Get the current value as a double
+ *
+ * @param[in]  cursor : Pointer to a JSON cursor
+ * @param[out] value  : Set to the value, correctly rounded
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not a number
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_double( cy_JSON_cursor_t* cursor, double* value );
+
+/** Get the current value as a boolean
+ *
+ * @param[in]  cursor : Pointer to a JSON cursor
+ * @param[out] value  : Set to the value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not true or false
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_get_bool( cy_JSON_cursor_t* cursor, bool* value );
+
+/** Enter the object or array started by the current token
+ *
+ * The next token is the first member or element of the container, or its end.
+ *
+ * @param[in] cursor : Pointer to a JSON cursor
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the current token is not the start of an object or an array
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_enter( cy_JSON_cursor_t* cursor );
+
+/** Leave the innermost object or array, without parsing the rest of its contents
+ *
+ * The next token is the one following the end of the container; its end is not returned. When the current token
+ * starts an object or an array, that container is the innermost one. Leaving the document root ends the document.
+ *
+ * @param[in] cursor : Pointer to a JSON cursor
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if no object or array is open
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_leave( cy_JSON_cursor_t* cursor );
+
+/** Skip the current value
+ *
+ * When the current token starts an object or an array, its contents are skipped without parsing them, and the next
+ * token is the one following its end. Nothing needs skipping for other tokens.
+ *
+ * @param[in] cursor : Pointer to a JSON cursor
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_cursor_skip( cy_JSON_cursor_t* cursor );
+
+/** Move the cursor to a member of the innermost object
+ *
+ * The members following the current token are searched, skipping the contents of the objects and arrays of the
+ * other members. When the current token starts an object, its members are searched. On success, the member found
+ * is the current token; otherwise the current token is the end of the object.
+ *
+ * @param[in] cursor     : Pointer to a JSON cursor
+ * @param[in] key        : Member name, as it appears in the JSON document
+ * @param[in] key_length : Length of the member name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the object has no other member with that name
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the innermost container is not an object
+ *                    - Any error returned by @ref cy_JSON_cursor_next
+ */
+cy_rslt_t cy_JSON_cursor_find_member( cy_JSON_cursor_t* cursor, const char* key, uint32_t key_length );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
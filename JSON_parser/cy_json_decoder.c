@@ -0,0 +1,467 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_decoder.h"
+#include "cy_json_parser_private.h"
+#include "cy_json_scan.h"
+#include <stddef.h>
+#include <string.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/* First character of a JSON number */
+#define JSON_DECODER_IS_NUMBER_START( ch )  ( ( ( ch ) == '-' ) || ( ( ( ch ) >= '0' ) && ( ( ch ) <= '9' ) ) )
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/* State of the decoder. Every object open in the parser is bound to a structure: other objects and arrays are skipped */
+typedef struct
+{
+    const cy_JSON_descriptor_t* descriptors[ CY_JSON_MAX_DEPTH ];   /* Descriptor of each open object */
+    uint8_t*                    structures[ CY_JSON_MAX_DEPTH ];    /* Structure of each open object */
+    uint32_t                    depth;                              /* Number of open objects */
+    const cy_JSON_descriptor_t* root_descriptor;
+    void*                       output;
+    const char*                 end;                                /* End of the JSON document */
+    bool                        decoded;                            /* Set once the root object starts */
+    cy_rslt_t                   result;                             /* Error found by the decoder */
+} json_decoder_t;
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+static const cy_JSON_field_t* json_decoder_find_field( const cy_JSON_descriptor_t* descriptor, const char* key, uint16_t key_length )
+{
+    const cy_JSON_field_t* field = descriptor->fields;
+    uint32_t               i;
+
+    for ( i = 0; i < descriptor->field_count; i++, field++ )
+    {
+        if ( ( field->key_length == key_length ) && ( memcmp( field->key, key, key_length ) == 0 ) )
+        {
+            return field;
+        }
+    }
+
+    return NULL;
+}
+
+/* Store an integer JSON number, checking that it fits in the structure member */
+static cy_rslt_t json_decoder_integer( const cy_JSON_number_t* number, const cy_JSON_object_t* json_object, uint8_t type, void* member )
+{
+    /* Fractions, exponents and digits dropped from the mantissa do not make an exact integer */
+    if ( ( json_object->value_type != JSON_NUMBER_TYPE ) || ( number->exponent != 0 ) )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    switch ( type )
+    {
+        case CY_JSON_FIELD_INT32:
+            if ( ( json_object->int64val < INT32_MIN ) || ( json_object->int64val > INT32_MAX ) )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            *(int32_t*)member = (int32_t)json_object->int64val;
+            break;
+
+        case CY_JSON_FIELD_UINT32:
+            if ( ( number->negative && ( number->mantissa != 0 ) ) || ( json_object->uint64val > UINT32_MAX ) )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            *(uint32_t*)member = (uint32_t)json_object->uint64val;
+            break;
+
+        case CY_JSON_FIELD_INT64:
+            if ( number->mantissa > ( ( number->negative ) ? ( (uint64_t)INT64_MAX + 1 ) : (uint64_t)INT64_MAX ) )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            *(int64_t*)member = json_object->int64val;
+            break;
+
+        case CY_JSON_FIELD_UINT64:
+        default:
+            if ( number->negative && ( number->mantissa != 0 ) )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            *(uint64_t*)member = json_object->uint64val;
+            break;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Store a converted JSON number into a member of one of the numeric types */
+static cy_rslt_t json_decoder_number( const cy_JSON_number_t* number, const cy_JSON_object_t* json_object, uint8_t type, void* member )
+{
+    switch ( type )
+    {
+        case CY_JSON_FIELD_FLOAT:
+            *(float*)member = json_object->floatval;
+            return CY_RSLT_SUCCESS;
+
+        case CY_JSON_FIELD_DOUBLE:
+            *(double*)member = json_object->doubleval;
+            return CY_RSLT_SUCCESS;
+
+        default:
+            return json_decoder_integer( number, json_object, type, member );
+    }
+}
+
+/* Size of the elements of an array member, or 0 if the type is not numeric */
+static uint32_t json_decoder_element_size( uint8_t type )
+{
+    switch ( type )
+    {
+        case CY_JSON_FIELD_INT32:
+            return sizeof( int32_t );
+        case CY_JSON_FIELD_UINT32:
+            return sizeof( uint32_t );
+        case CY_JSON_FIELD_INT64:
+            return sizeof( int64_t );
+        case CY_JSON_FIELD_UINT64:
+            return sizeof( uint64_t );
+        case CY_JSON_FIELD_FLOAT:
+            return sizeof( float );
+        case CY_JSON_FIELD_DOUBLE:
+            return sizeof( double );
+        default:
+            return 0;
+    }
+}
+
+/* Decode the JSON array of numbers starting at position into an array of capacity elements of the given type.
+ * The numbers are scanned directly, without going through the parser context.
+ */
+static cy_rslt_t json_decoder_array( const char* position, const char* end, uint8_t type, uint8_t* output, uint32_t capacity, uint32_t* count )
+{
+    cy_JSON_number_t number;
+    cy_JSON_object_t json_object;
+    uint32_t         size = json_decoder_element_size( type );
+    cy_rslt_t        result;
+
+    *count   = 0;
+    position = cy_json_scan_whitespace( position, end );
+    if ( position == end )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+    if ( *position != '[' )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    position = cy_json_scan_whitespace( position + 1, end );
+    if ( ( position < end ) && ( *position == ']' ) )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    while ( true )
+    {
+        if ( position == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( !JSON_DECODER_IS_NUMBER_START( *position ) )
+        {
+            /* A value which is not a number, or a missing value */
+            return ( ( *position == ']' ) || ( *position == ',' ) ) ? CY_RSLT_JSON_GENERIC_ERROR : CY_RSLT_JSON_TYPE_MISMATCH;
+        }
+        if ( *count == capacity )
+        {
+            return CY_RSLT_JSON_BUFFER_OVERFLOW;
+        }
+
+        position = cy_json_parser_scan_number( position, end, &number, &json_object );
+        if ( position == NULL )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        if ( position == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+#ifdef CY_JSON_FIXED_POINT
+        if ( ( type == CY_JSON_FIELD_FLOAT ) || ( type == CY_JSON_FIELD_DOUBLE ) )
+        {
+            cy_json_parser_number_floating( &number, &json_object );
+        }
+#endif
+
+        result = json_decoder_number( &number, &json_object, type, output + ( *count * size ) );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        ( *count )++;
+
+        position = cy_json_scan_whitespace( position, end );
+        if ( position == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *position == ']' )
+        {
+            return CY_RSLT_SUCCESS;
+        }
+        if ( *position != ',' )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        position = cy_json_scan_whitespace( position + 1, end );
+    }
+}
+
+/* Store a string, number or literal into its structure member */
+static cy_rslt_t json_decoder_value( cy_JSON_parser_ctx_t* ctx, cy_JSON_object_t* json_object, const cy_JSON_field_t* field, void* member )
+{
+    cy_rslt_t result;
+    uint32_t  length;
+
+    if ( json_object->value_type == JSON_NULL_TYPE )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    switch ( field->type )
+    {
+        case CY_JSON_FIELD_INT32:
+        case CY_JSON_FIELD_UINT32:
+        case CY_JSON_FIELD_INT64:
+        case CY_JSON_FIELD_UINT64:
+        case CY_JSON_FIELD_FLOAT:
+        case CY_JSON_FIELD_DOUBLE:
+            if ( json_object->value_type != JSON_NUMBER_TYPE )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            cy_json_parser_convert_number( ctx, json_object );
+            return json_decoder_number( &ctx->number, json_object, field->type, member );
+
+        case CY_JSON_FIELD_BOOL:
+            if ( json_object->value_type != JSON_BOOLEAN_TYPE )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            *(bool*)member = ( json_object->value[ 0 ] == TRUE_TOKEN );
+            return CY_RSLT_SUCCESS;
+
+        case CY_JSON_FIELD_STRING:
+            if ( json_object->value_type != JSON_STRING_TYPE )
+            {
+                return CY_RSLT_JSON_TYPE_MISMATCH;
+            }
+            /* Keep room for the NUL terminator */
+            result = cy_JSON_unescape( json_object->value, ctx->value_length, (char*)member, field->size - 1, &length );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            ( (char*)member )[ length ] = '\0';
+            return CY_RSLT_SUCCESS;
+
+        default:
+            return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+}
+
+static cy_rslt_t json_decoder_event( struct cy_JSON_parser_ctx* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg )
+{
+    json_decoder_t*        decoder = (json_decoder_t*)arg;
+    const cy_JSON_field_t* field;
+    uint8_t*               structure;
+    uint32_t               size;
+
+    if ( event == CY_JSON_EVENT_CONTAINER_END )
+    {
+        decoder->depth--;
+        return CY_RSLT_SUCCESS;
+    }
+
+    if ( decoder->depth == 0 )
+    {
+        /* The input holds a single JSON document: another one must not follow the root */
+        if ( decoder->decoded )
+        {
+            decoder->result = CY_RSLT_JSON_GENERIC_ERROR;
+            return decoder->result;
+        }
+
+        /* Root of the document */
+        if ( json_object->value_type != JSON_OBJECT_TYPE )
+        {
+            decoder->result = CY_RSLT_JSON_TYPE_MISMATCH;
+            return decoder->result;
+        }
+        decoder->descriptors[ 0 ] = decoder->root_descriptor;
+        decoder->structures[ 0 ]  = (uint8_t*)decoder->output;
+        decoder->depth            = 1;
+        decoder->decoded          = true;
+        return CY_RSLT_SUCCESS;
+    }
+
+    field = json_decoder_find_field( decoder->descriptors[ decoder->depth - 1 ], ctx->key, ctx->key_length );
+    if ( field == NULL )
+    {
+        /* Unknown member */
+        return ( event == CY_JSON_EVENT_CONTAINER_START ) ? CY_JSON_EVENT_RSLT_SKIP : CY_RSLT_SUCCESS;
+    }
+
+    if ( event == CY_JSON_EVENT_VALUE )
+    {
+        decoder->result = json_decoder_value( ctx, json_object, field, decoder->structures[ decoder->depth - 1 ] + field->offset );
+        return decoder->result;
+    }
+
+    if ( ( json_object->value_type == JSON_ARRAY_TYPE ) && ( field->type == CY_JSON_FIELD_ARRAY ) )
+    {
+        /* The elements are decoded from the input directly, and the parser skips the array */
+        structure = decoder->structures[ decoder->depth - 1 ];
+        size      = json_decoder_element_size( field->element_type );
+        if ( size == 0 )
+        {
+            decoder->result = CY_RSLT_JSON_TYPE_MISMATCH;
+            return decoder->result;
+        }
+        decoder->result = json_decoder_array( json_object->value, decoder->end, field->element_type, structure + field->offset, field->size / size,
+                                              (uint32_t*)( structure + field->count_offset ) );
+        return ( decoder->result == CY_RSLT_SUCCESS ) ? CY_JSON_EVENT_RSLT_SKIP : decoder->result;
+    }
+
+    if ( ( json_object->value_type != JSON_OBJECT_TYPE ) || ( field->type != CY_JSON_FIELD_OBJECT ) || ( field->nested == NULL ) )
+    {
+        decoder->result = CY_RSLT_JSON_TYPE_MISMATCH;
+        return decoder->result;
+    }
+
+    if ( decoder->depth >= CY_JSON_MAX_DEPTH )
+    {
+        return CY_RSLT_JSON_DEPTH_EXCEEDED;
+    }
+
+    decoder->descriptors[ decoder->depth ] = field->nested;
+    decoder->structures[ decoder->depth ]  = decoder->structures[ decoder->depth - 1 ] + field->offset;
+    decoder->depth++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_decode( const cy_JSON_descriptor_t* descriptor, void* output, const char* json_input, uint32_t input_length )
+{
+    cy_JSON_parser_ctx_t ctx;
+    json_decoder_t       decoder;
+    cy_rslt_t            result;
+
+    if ( ( descriptor == NULL ) || ( output == NULL ) || ( json_input == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( &decoder, 0x0, sizeof( decoder ) );
+    decoder.root_descriptor = descriptor;
+    decoder.output          = output;
+    decoder.end             = json_input + input_length;
+    decoder.result          = CY_RSLT_SUCCESS;
+
+    /* The whole document is in json_input: the context does not need a token buffer */
+    cy_JSON_parser_ctx_init( &ctx );
+    cy_json_parser_set_event_handler( &ctx, json_decoder_event, &decoder );
+
+    result = cy_JSON_parser_ctx_parse( &ctx, json_input, input_length );
+
+    if ( decoder.result != CY_RSLT_SUCCESS )
+    {
+        return decoder.result;
+    }
+
+    if ( ( ( result == CY_RSLT_SUCCESS ) && !decoder.decoded ) || ( result == CY_RSLT_JSON_BUFFER_OVERFLOW ) )
+    {
+        /* Nothing was parsed, or the input ends in the middle of a token the context has no token buffer to keep */
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    return result;
+}
+
+
+cy_rslt_t cy_JSON_decode_array( const char* json_input, uint32_t input_length, cy_JSON_field_type_t type, void* output, uint32_t capacity, uint32_t* count )
+{
+    cy_rslt_t result;
+    uint32_t  decoded;
+
+    if ( ( json_input == NULL ) || ( ( output == NULL ) && ( capacity != 0 ) ) || ( json_decoder_element_size( (uint8_t)type ) == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    result = json_decoder_array( json_input, json_input + input_length, (uint8_t)type, (uint8_t*)output, capacity, &decoded );
+    if ( count != NULL )
+    {
+        *count = decoded;
+    }
+
+    return result;
+}
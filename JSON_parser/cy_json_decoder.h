@@ -0,0 +1,241 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * The JSON decoder utility decodes a JSON document directly into a C structure described by a table of fields.
+ *
+ * Each field of the table binds a member name to a member of the structure: its offset, its type, and its size. Members of
+ * nested objects are decoded into nested structures described by their own table. The JSON document is decoded in a single
+ * parse; members without a field are ignored, and their objects and arrays are skipped without parsing their contents.
+ *
+ * Example:
+ * @code
+ * typedef struct { int32_t temp; char mode[ 8 ]; } reported_t;
+ * typedef struct { uint32_t version; reported_t reported; } shadow_t;
+ *
+ * static const cy_JSON_field_t reported_fields[] =
+ * {
+ *     CY_JSON_FIELD( reported_t, temp, "temp", CY_JSON_FIELD_INT32 ),
+ *     CY_JSON_FIELD( reported_t, mode, "mode", CY_JSON_FIELD_STRING )
+ * };
+ * static const cy_JSON_descriptor_t reported_descriptor = CY_JSON_DESCRIPTOR( reported_fields );
+ *
+ * static const cy_JSON_field_t shadow_fields[] =
+ * {
+ *     CY_JSON_FIELD( shadow_t, version, "version", CY_JSON_FIELD_UINT32 ),
+ *     CY_JSON_FIELD_NESTED( shadow_t, reported, "reported", reported_descriptor )
+ * };
+ * static const cy_JSON_descriptor_t shadow_descriptor = CY_JSON_DESCRIPTOR( shadow_fields );
+ *
+ * result = cy_JSON_decode( &shadow_descriptor, &shadow, json_input, input_length );
+ * @endcode
+ *
+ * Arrays of numbers, such as sensor samples, are decoded in a single call into an array member and its count, without
+ * reporting each element:
+ * @code
+ * typedef struct { float samples[ 512 ]; uint32_t sample_count; } telemetry_t;
+ *
+ * static const cy_JSON_field_t telemetry_fields[] =
+ * {
+ *     CY_JSON_FIELD_ARRAY( telemetry_t, samples, sample_count, "samples", CY_JSON_FIELD_FLOAT )
+ * };
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/** Describe a member of the structure `type`, decoded from the JSON member `key`. `key` must be a string literal */
+#define CY_JSON_FIELD( type, member, key, field_type ) \
+    { (key), (uint16_t)( sizeof( key ) - 1 ), (uint8_t)( field_type ), (uint32_t)offsetof( type, member ), (uint32_t)sizeof( ( (type*)0 )->member ), NULL, 0, 0 }
+
+/** Describe a structure member of the structure `type`, decoded from the JSON object `key` with the fields of `descriptor` */
+#define CY_JSON_FIELD_NESTED( type, member, key, descriptor ) \
+    { (key), (uint16_t)( sizeof( key ) - 1 ), (uint8_t)CY_JSON_FIELD_OBJECT, (uint32_t)offsetof( type, member ), (uint32_t)sizeof( ( (type*)0 )->member ), &( descriptor ), 0, 0 }
+
+/** Describe an array member of the structure `type`, decoded from the JSON array of numbers `key`. `element_type` is the
+ *  numeric @ref cy_JSON_field_type_t of its elements, and the uint32_t member `count` receives the number of elements */
+#define CY_JSON_FIELD_ARRAY( type, member, count, key, element_type ) \
+    { (key), (uint16_t)( sizeof( key ) - 1 ), (uint8_t)CY_JSON_FIELD_ARRAY, (uint32_t)offsetof( type, member ), (uint32_t)sizeof( ( (type*)0 )->member ), NULL, \
+      (uint8_t)( element_type ), (uint32_t)offsetof( type, count ) }
+
+/** Describe a structure with an array of fields */
+#define CY_JSON_DESCRIPTOR( fields ) \
+    { (fields), (uint32_t)( sizeof( fields ) / sizeof( ( fields )[ 0 ] ) ) }
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_enums
+ *//** \{ */
+/******************************************************************************/
+
+/** Types of the structure members decoded by the JSON decoder */
+typedef enum
+{
+    CY_JSON_FIELD_INT32,   /**< int32_t, decoded from an integer JSON number */
+    CY_JSON_FIELD_UINT32,  /**< uint32_t, decoded from a non-negative integer JSON number */
+    CY_JSON_FIELD_INT64,   /**< int64_t, decoded from an integer JSON number */
+    CY_JSON_FIELD_UINT64,  /**< uint64_t, decoded from a non-negative integer JSON number */
+    CY_JSON_FIELD_FLOAT,   /**< float, decoded from a JSON number */
+    CY_JSON_FIELD_DOUBLE,  /**< double, decoded from a JSON number */
+    CY_JSON_FIELD_BOOL,    /**< bool, decoded from true or false */
+    CY_JSON_FIELD_STRING,  /**< char array, decoded from a JSON string with its escape sequences and NUL terminated */
+    CY_JSON_FIELD_OBJECT,  /**< Structure, decoded from a JSON object with a nested descriptor */
+    CY_JSON_FIELD_ARRAY    /**< Array of one of the numeric types above, decoded from a JSON array of numbers */
+} cy_JSON_field_type_t;
+
+/** \} */
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+struct cy_JSON_descriptor;
+
+/** Field of a JSON decoder descriptor. Use @ref CY_JSON_FIELD and @ref CY_JSON_FIELD_NESTED to declare fields */
+typedef struct
+{
+    const char*                         key;            /**< JSON member name */
+    uint16_t                            key_length;     /**< Length of the JSON member name */
+    uint8_t                             type;           /**< @ref cy_JSON_field_type_t of the structure member */
+    uint32_t                            offset;         /**< Offset of the member in the structure */
+    uint32_t                            size;           /**< Size of the member in bytes */
+    const struct cy_JSON_descriptor*    nested;         /**< Descriptor of a CY_JSON_FIELD_OBJECT member */
+    uint8_t                             element_type;   /**< @ref cy_JSON_field_type_t of the elements of a CY_JSON_FIELD_ARRAY member */
+    uint32_t                            count_offset;   /**< Offset in the structure of the uint32_t count of a CY_JSON_FIELD_ARRAY member */
+} cy_JSON_field_t;
+
+/** JSON decoder descriptor of a structure. Use @ref CY_JSON_DESCRIPTOR to declare descriptors */
+typedef struct cy_JSON_descriptor
+{
+    const cy_JSON_field_t*  fields;         /**< Fields of the structure */
+    uint32_t                field_count;    /**< Number of fields */
+} cy_JSON_descriptor_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Decode a JSON document into a structure
+ *
+ * The root of the JSON document must be an object. Members of the structure without a matching JSON member, or whose JSON
+ * member is null, are left unchanged. Member names are compared with the name as it appears in the JSON document, and
+ * the escape sequences of strings are decoded as by @ref cy_JSON_unescape.
+ *
+ * The decoder runs a parser context allocated on the stack of the caller. It takes sizeof( cy_JSON_parser_ctx_t ) bytes,
+ * about 1 KB with the default CY_JSON_MAX_DEPTH of 8, and two more pointers per level of CY_JSON_MAX_DEPTH to track the
+ * nested structures: the stack of the calling thread must have room for them.
+ *
+ * @param[in]  descriptor   : Descriptor of the structure
+ * @param[out] output       : Pointer to the structure
+ * @param[in]  json_input   : Pointer to the JSON document
+ * @param[in]  input_length : Length of the JSON document
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if a JSON value does not match the type of its field, or does not fit in it
+ *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if a string does not fit in its field
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if the structures are nested deeper than CY_JSON_MAX_DEPTH
+ *                    - CY_RSLT_JSON_INCOMPLETE if the JSON document is truncated
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed, or followed by another one
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_decode( const cy_JSON_descriptor_t* descriptor, void* output, const char* json_input, uint32_t input_length );
+
+/** Decode a JSON array of numbers into a C array
+ *
+ * The elements are converted as the numbers of the parser are, without invoking a callback per element, and
+ * their digits are read eight at a time. Integer types only accept integer JSON numbers which fit in them.
+ * The input may continue after the end of the array.
+ *
+ * @param[in]  json_input   : Pointer to the JSON array, optionally preceded by whitespace
+ * @param[in]  input_length : Length of the JSON data
+ * @param[in]  type         : Type of the elements of the C array: CY_JSON_FIELD_INT32, CY_JSON_FIELD_UINT32, CY_JSON_FIELD_INT64,
+ *                            CY_JSON_FIELD_UINT64, CY_JSON_FIELD_FLOAT or CY_JSON_FIELD_DOUBLE
+ * @param[out] output       : Pointer to the C array
+ * @param[in]  capacity     : Number of elements of the C array
+ * @param[out] count        : Set to the number of elements decoded. On CY_RSLT_JSON_TYPE_MISMATCH, it is the position
+ *                            of the first element which is not a number, or does not fit in the type
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if an element is not a number or does not fit in the type, or the JSON value is not an array
+ *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if the JSON array has more than capacity elements
+ *                    - CY_RSLT_JSON_INCOMPLETE if the JSON array is truncated
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON array is malformed
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_decode_array( const char* json_input, uint32_t input_length, cy_JSON_field_type_t type, void* output, uint32_t capacity, uint32_t* count );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
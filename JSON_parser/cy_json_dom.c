@@ -0,0 +1,672 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_dom.h"
+#include "cy_json_parser_private.h"
+#include <stddef.h>
+#include <string.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* Alignment of the nodes allocated from the arena */
+#define JSON_DOM_ALIGNMENT             ( sizeof( void* ) )
+
+/* Longest number written by the JSON writer */
+#define JSON_DOM_NUMBER_SIZE           (32)
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/* State of the tree while it is built */
+typedef struct
+{
+    cy_JSON_dom_t*      dom;
+    cy_JSON_node_t*     open;           /* Innermost object or array still open */
+    cy_JSON_node_t*     root;           /* Root node, once it is complete */
+    bool                full;           /* Set when the arena is exhausted */
+} json_dom_builder_t;
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+static const char json_dom_true[]  = "true";
+static const char json_dom_false[] = "false";
+static const char json_dom_null[]  = "null";
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+static void* json_dom_alloc( cy_JSON_dom_t* dom, uint32_t size, uint32_t alignment )
+{
+    uint32_t offset = ( dom->used + alignment - 1 ) & ~( alignment - 1 );
+
+    if ( ( offset > dom->size ) || ( size > ( dom->size - offset ) ) )
+    {
+        return NULL;
+    }
+    dom->used = offset + size;
+
+    return dom->arena + offset;
+}
+
+static cy_JSON_node_t* json_dom_new( cy_JSON_dom_t* dom, cy_JSON_type_t type )
+{
+    cy_JSON_node_t* node = (cy_JSON_node_t*)json_dom_alloc( dom, sizeof( cy_JSON_node_t ), JSON_DOM_ALIGNMENT );
+
+    if ( node != NULL )
+    {
+        memset( node, 0x0, sizeof( *node ) );
+        node->type = type;
+    }
+
+    return node;
+}
+
+/* Member names and strings without escape sequences stay in the JSON document. The others are decoded in the arena */
+static bool json_dom_string( cy_JSON_dom_t* dom, const char* string, uint32_t length, const char** decoded, uint32_t* decoded_length )
+{
+    char* copy;
+
+    if ( memchr( string, '\\', length ) == NULL )
+    {
+        *decoded        = string;
+        *decoded_length = length;
+        return true;
+    }
+
+    /* The decoded string is never longer than the escaped one */
+    copy = (char*)json_dom_alloc( dom, length, 1 );
+    if ( ( copy == NULL ) || ( cy_JSON_unescape( string, length, copy, length, decoded_length ) != CY_RSLT_SUCCESS ) )
+    {
+        return false;
+    }
+    dom->used -= length - *decoded_length;
+    *decoded   = copy;
+
+    return true;
+}
+
+/* Make a complete node the root, or a child of the innermost open container. Children are linked in reverse order
+ * while their container is open.
+ */
+static void json_dom_attach( json_dom_builder_t* builder, cy_JSON_node_t* node )
+{
+    if ( builder->open == NULL )
+    {
+        builder->root = node;
+    }
+    else
+    {
+        node->next            = builder->open->child;
+        builder->open->child  = node;
+    }
+}
+
+/* Build the tree from the parse events. While an object or array is open, its next field links to the enclosing
+ * open container; it is linked to its parent when it ends.
+ */
+static cy_rslt_t json_dom_event( struct cy_JSON_parser_ctx* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg )
+{
+    json_dom_builder_t* builder = (json_dom_builder_t*)arg;
+    cy_JSON_node_t*     node;
+    cy_JSON_node_t*     child;
+    cy_JSON_node_t*     previous = NULL;
+
+    /* The input holds a single JSON document: another one must not follow the root */
+    if ( ( builder->root != NULL ) && ( builder->open == NULL ) )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    if ( event == CY_JSON_EVENT_CONTAINER_END )
+    {
+        node          = builder->open;
+        builder->open = node->next;
+        node->next    = NULL;
+
+        /* Put the children back in document order */
+        while ( node->child != NULL )
+        {
+            child       = node->child;
+            node->child = child->next;
+            child->next = previous;
+            previous    = child;
+        }
+        node->child = previous;
+
+        json_dom_attach( builder, node );
+        return CY_RSLT_SUCCESS;
+    }
+
+    node = json_dom_new( builder->dom, json_object->value_type );
+    if ( ( node == NULL ) ||
+         ( ( ctx->key != NULL ) && !json_dom_string( builder->dom, ctx->key, ctx->key_length, &node->key, &node->key_length ) ) )
+    {
+        builder->full = true;
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+
+    switch ( json_object->value_type )
+    {
+        case JSON_OBJECT_TYPE:
+        case JSON_ARRAY_TYPE:
+            node->next    = builder->open;
+            builder->open = node;
+            return CY_RSLT_SUCCESS;
+
+        case JSON_STRING_TYPE:
+            if ( !json_dom_string( builder->dom, json_object->value, ctx->value_length, &node->value, &node->length ) )
+            {
+                builder->full = true;
+                return CY_RSLT_JSON_BUFFER_OVERFLOW;
+            }
+            break;
+
+        case JSON_BOOLEAN_TYPE:
+            node->value  = ( json_object->value[ 0 ] == 't' ) ? json_dom_true : json_dom_false;
+            node->length = (uint32_t)strlen( node->value );
+            break;
+
+        case JSON_NULL_TYPE:
+            node->value  = json_dom_null;
+            node->length = sizeof( json_dom_null ) - 1;
+            break;
+
+        default:
+            node->type   = JSON_NUMBER_TYPE;
+            node->value  = json_object->value;
+            node->length = ctx->value_length;
+            break;
+    }
+
+    json_dom_attach( builder, node );
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Create a string or number node, with a copy of its text */
+static cy_rslt_t json_dom_new_text( cy_JSON_dom_t* dom, cy_JSON_type_t type, const char* text, uint32_t length, cy_JSON_node_t** node )
+{
+    cy_JSON_node_t* new_node;
+    char*           copy;
+    uint32_t        used;
+
+    if ( ( dom == NULL ) || ( ( text == NULL ) && ( length != 0 ) ) || ( node == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    used     = dom->used;
+    new_node = json_dom_new( dom, type );
+    copy     = ( new_node != NULL ) ? (char*)json_dom_alloc( dom, length, 1 ) : NULL;
+    if ( copy == NULL )
+    {
+        dom->used = used;
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+
+    memcpy( copy, text, length );
+    new_node->value  = copy;
+    new_node->length = length;
+    *node            = new_node;
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t json_dom_find( const cy_JSON_node_t* object, const char* key, uint32_t key_length, cy_JSON_node_t** member, cy_JSON_node_t** previous )
+{
+    cy_JSON_node_t* node;
+
+    if ( ( object == NULL ) || ( ( key == NULL ) && ( key_length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( object->type != JSON_OBJECT_TYPE )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    *previous = NULL;
+    for ( node = object->child; node != NULL; node = node->next )
+    {
+        if ( ( node->key_length == key_length ) && ( memcmp( node->key, key, key_length ) == 0 ) )
+        {
+            *member = node;
+            return CY_RSLT_SUCCESS;
+        }
+        *previous = node;
+    }
+
+    return CY_RSLT_JSON_NOT_FOUND;
+}
+
+/* Write a string, number or literal node */
+static cy_rslt_t json_dom_write_value( const cy_JSON_node_t* node, cy_JSON_writer_t* writer )
+{
+    switch ( node->type )
+    {
+        case JSON_STRING_TYPE:
+            return cy_JSON_writer_string( writer, node->value, node->length );
+
+        case JSON_BOOLEAN_TYPE:
+            return cy_JSON_writer_bool( writer, ( node->value[ 0 ] == 't' ) );
+
+        case JSON_NULL_TYPE:
+            return cy_JSON_writer_null( writer );
+
+        default:
+            return cy_JSON_writer_number( writer, node->value, node->length );
+    }
+}
+
+
+cy_rslt_t cy_JSON_dom_init( cy_JSON_dom_t* dom, void* arena, uint32_t size )
+{
+    if ( ( dom == NULL ) || ( ( arena == NULL ) && ( size != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    dom->arena = (uint8_t*)arena;
+    dom->size  = size;
+    dom->used  = 0;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_parse( cy_JSON_dom_t* dom, const char* json_input, uint32_t input_length, cy_JSON_node_t** root )
+{
+    cy_JSON_parser_ctx_t ctx;
+    json_dom_builder_t   builder;
+    cy_rslt_t            result;
+    uint32_t             used;
+
+    if ( ( dom == NULL ) || ( json_input == NULL ) || ( root == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    used         = dom->used;
+    builder.dom  = dom;
+    builder.open = NULL;
+    builder.root = NULL;
+    builder.full = false;
+
+    /* The whole document is in json_input: the context does not need a token buffer */
+    cy_JSON_parser_ctx_init( &ctx );
+    cy_json_parser_set_event_handler( &ctx, json_dom_event, &builder );
+
+    result = cy_JSON_parser_ctx_parse( &ctx, json_input, input_length );
+
+    if ( builder.full )
+    {
+        result = CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+    else if ( ( ( result == CY_RSLT_SUCCESS ) && ( builder.root == NULL ) ) || ( result == CY_RSLT_JSON_BUFFER_OVERFLOW ) )
+    {
+        /* Nothing was parsed, or the input ends in the middle of a token the context has no token buffer to keep */
+        result = CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        dom->used = used;
+        return result;
+    }
+
+    *root = builder.root;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_get_member( const cy_JSON_node_t* object, const char* key, uint32_t key_length, cy_JSON_node_t** member )
+{
+    cy_JSON_node_t* previous;
+
+    if ( member == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    return json_dom_find( object, key, key_length, member, &previous );
+}
+
+
+cy_rslt_t cy_JSON_dom_get_element( const cy_JSON_node_t* array, uint32_t position, cy_JSON_node_t** element )
+{
+    cy_JSON_node_t* node;
+
+    if ( ( array == NULL ) || ( element == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( array->type != JSON_ARRAY_TYPE )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    for ( node = array->child; node != NULL; node = node->next )
+    {
+        if ( position-- == 0 )
+        {
+            *element = node;
+            return CY_RSLT_SUCCESS;
+        }
+    }
+
+    return CY_RSLT_JSON_NOT_FOUND;
+}
+
+
+cy_rslt_t cy_JSON_dom_new_string( cy_JSON_dom_t* dom, const char* value, uint32_t length, cy_JSON_node_t** node )
+{
+    return json_dom_new_text( dom, JSON_STRING_TYPE, value, length, node );
+}
+
+
+cy_rslt_t cy_JSON_dom_new_int64( cy_JSON_dom_t* dom, int64_t value, cy_JSON_node_t** node )
+{
+    cy_JSON_writer_t writer;
+    char             number[ JSON_DOM_NUMBER_SIZE ];
+    cy_rslt_t        result;
+
+    cy_JSON_writer_init( &writer, number, sizeof( number ), NULL, NULL );
+    result = cy_JSON_writer_int64( &writer, value );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    return json_dom_new_text( dom, JSON_NUMBER_TYPE, number, writer.total, node );
+}
+
+
+cy_rslt_t cy_JSON_dom_new_uint64( cy_JSON_dom_t* dom, uint64_t value, cy_JSON_node_t** node )
+{
+    cy_JSON_writer_t writer;
+    char             number[ JSON_DOM_NUMBER_SIZE ];
+    cy_rslt_t        result;
+
+    cy_JSON_writer_init( &writer, number, sizeof( number ), NULL, NULL );
+    result = cy_JSON_writer_uint64( &writer, value );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    return json_dom_new_text( dom, JSON_NUMBER_TYPE, number, writer.total, node );
+}
+
+
+cy_rslt_t cy_JSON_dom_new_double( cy_JSON_dom_t* dom, double value, cy_JSON_node_t** node )
+{
+    cy_JSON_writer_t writer;
+    char             number[ JSON_DOM_NUMBER_SIZE ];
+    cy_rslt_t        result;
+
+    cy_JSON_writer_init( &writer, number, sizeof( number ), NULL, NULL );
+    result = cy_JSON_writer_double( &writer, value );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    return json_dom_new_text( dom, JSON_NUMBER_TYPE, number, writer.total, node );
+}
+
+
+cy_rslt_t cy_JSON_dom_new_bool( cy_JSON_dom_t* dom, bool value, cy_JSON_node_t** node )
+{
+    cy_rslt_t result = cy_JSON_dom_new_node( dom, JSON_NULL_TYPE, node );
+
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        ( *node )->type   = JSON_BOOLEAN_TYPE;
+        ( *node )->value  = ( value ) ? json_dom_true : json_dom_false;
+        ( *node )->length = (uint32_t)strlen( ( *node )->value );
+    }
+
+    return result;
+}
+
+
+cy_rslt_t cy_JSON_dom_new_node( cy_JSON_dom_t* dom, cy_JSON_type_t type, cy_JSON_node_t** node )
+{
+    cy_JSON_node_t* new_node;
+
+    if ( ( dom == NULL ) || ( node == NULL ) ||
+         ( ( type != JSON_NULL_TYPE ) && ( type != JSON_OBJECT_TYPE ) && ( type != JSON_ARRAY_TYPE ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    new_node = json_dom_new( dom, type );
+    if ( new_node == NULL )
+    {
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+    if ( type == JSON_NULL_TYPE )
+    {
+        new_node->value  = json_dom_null;
+        new_node->length = sizeof( json_dom_null ) - 1;
+    }
+    *node = new_node;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_set_member( cy_JSON_dom_t* dom, cy_JSON_node_t* object, const char* key, uint32_t key_length, cy_JSON_node_t* node )
+{
+    cy_JSON_node_t* member;
+    cy_JSON_node_t* previous;
+    char*           copy;
+    cy_rslt_t       result;
+
+    if ( ( dom == NULL ) || ( node == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    result = json_dom_find( object, key, key_length, &member, &previous );
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        /* Replace the member in place, keeping its name */
+        node->key        = member->key;
+        node->key_length = member->key_length;
+        node->next       = member->next;
+    }
+    else if ( result == CY_RSLT_JSON_NOT_FOUND )
+    {
+        copy = (char*)json_dom_alloc( dom, key_length, 1 );
+        if ( copy == NULL )
+        {
+            return CY_RSLT_JSON_BUFFER_OVERFLOW;
+        }
+        memcpy( copy, key, key_length );
+        node->key        = copy;
+        node->key_length = key_length;
+        node->next       = NULL;
+    }
+    else
+    {
+        return result;
+    }
+
+    /* previous is the member found, or the last member */
+    if ( previous == NULL )
+    {
+        object->child  = node;
+    }
+    else
+    {
+        previous->next = node;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_delete_member( cy_JSON_node_t* object, const char* key, uint32_t key_length )
+{
+    cy_JSON_node_t* member;
+    cy_JSON_node_t* previous;
+    cy_rslt_t       result;
+
+    result = json_dom_find( object, key, key_length, &member, &previous );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    if ( previous == NULL )
+    {
+        object->child  = member->next;
+    }
+    else
+    {
+        previous->next = member->next;
+    }
+    member->next = NULL;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_append_element( cy_JSON_node_t* array, cy_JSON_node_t* node )
+{
+    cy_JSON_node_t** link;
+
+    if ( ( array == NULL ) || ( node == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( array->type != JSON_ARRAY_TYPE )
+    {
+        return CY_RSLT_JSON_TYPE_MISMATCH;
+    }
+
+    for ( link = &array->child; *link != NULL; link = &( *link )->next )
+    {
+    }
+    node->key        = NULL;
+    node->key_length = 0;
+    node->next       = NULL;
+    *link            = node;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_dom_write( const cy_JSON_node_t* node, cy_JSON_writer_t* writer )
+{
+    const cy_JSON_node_t* stack[ CY_JSON_WRITER_MAX_DEPTH ];
+    uint32_t              depth  = 0;
+    cy_rslt_t             result = CY_RSLT_SUCCESS;
+
+    if ( ( node == NULL ) || ( writer == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* Walk the tree in document order, keeping the open objects and arrays on a stack */
+    while ( result == CY_RSLT_SUCCESS )
+    {
+        if ( ( depth > 0 ) && ( stack[ depth - 1 ]->type == JSON_OBJECT_TYPE ) )
+        {
+            result = cy_JSON_writer_key( writer, node->key, node->key_length );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                break;
+            }
+        }
+
+        if ( ( node->type == JSON_OBJECT_TYPE ) || ( node->type == JSON_ARRAY_TYPE ) )
+        {
+            result = ( node->type == JSON_OBJECT_TYPE ) ? cy_JSON_writer_begin_object( writer ) : cy_JSON_writer_begin_array( writer );
+            if ( ( result == CY_RSLT_SUCCESS ) && ( node->child != NULL ) )
+            {
+                stack[ depth++ ] = node;
+                node             = node->child;
+                continue;
+            }
+            if ( result == CY_RSLT_SUCCESS )
+            {
+                result = ( node->type == JSON_OBJECT_TYPE ) ? cy_JSON_writer_end_object( writer ) : cy_JSON_writer_end_array( writer );
+            }
+        }
+        else
+        {
+            result = json_dom_write_value( node, writer );
+        }
+
+        /* Close the containers whose last child has been written */
+        while ( ( result == CY_RSLT_SUCCESS ) && ( depth > 0 ) && ( node->next == NULL ) )
+        {
+            node   = stack[ --depth ];
+            result = ( node->type == JSON_OBJECT_TYPE ) ? cy_JSON_writer_end_object( writer ) : cy_JSON_writer_end_array( writer );
+        }
+        if ( depth == 0 )
+        {
+            break;
+        }
+        node = node->next;
+    }
+
+    return result;
+}
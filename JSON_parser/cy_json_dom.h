@@ -0,0 +1,335 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/**
+ * @file
+ * The JSON DOM utility loads a JSON document into a tree of nodes which the application can modify, then writes it back.
+ *
+ * The nodes are allocated from an arena provided by the application: there is no heap allocation. Member names and
+ * string values are held decoded; those without escape sequences refer to the parsed JSON document, which must remain
+ * valid and unchanged while the tree is in use. Numbers are held as text, so that they are written back unchanged.
+ * The tree is written with a @ref cy_JSON_writer_t, compactly.
+ *
+ * Example:
+ * @code
+ * cy_JSON_dom_t   dom;
+ * cy_JSON_node_t* root;
+ * cy_JSON_node_t* version;
+ *
+ * cy_JSON_dom_init( &dom, arena, sizeof( arena ) );
+ * result = cy_JSON_dom_parse( &dom, json_input, input_length, &root );
+ * if ( ( result == CY_RSLT_SUCCESS ) && ( cy_JSON_dom_new_uint64( &dom, 7, &version ) == CY_RSLT_SUCCESS ) )
+ * {
+ *     cy_JSON_dom_set_member( &dom, root, "version", 7, version );
+ *     cy_JSON_dom_delete_member( root, "delta", 5 );
+ *     result = cy_JSON_dom_write( root, &writer );
+ * }
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+#include "cy_json_writer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/** JSON DOM node: a value, with its member name when it is a member of an object */
+typedef struct cy_JSON_node
+{
+    struct cy_JSON_node*    next;           /**< Next member or element of the parent object or array, NULL for the last one */
+    struct cy_JSON_node*    child;          /**< First member or element of an object or array, NULL if it is empty */
+    const char*             key;            /**< Member name, decoded and not NUL terminated; NULL for array elements and the root */
+    uint32_t                key_length;     /**< Length of the member name */
+    const char*             value;          /**< String decoded and not NUL terminated, number text, "true", "false" or "null". NULL for objects and arrays */
+    uint32_t                length;         /**< Length of the value */
+    cy_JSON_type_t          type;           /**< JSON_STRING_TYPE, JSON_NUMBER_TYPE, JSON_BOOLEAN_TYPE, JSON_NULL_TYPE, JSON_OBJECT_TYPE or JSON_ARRAY_TYPE */
+} cy_JSON_node_t;
+
+/** JSON DOM arena. The members are internal to the JSON DOM utility and must not be accessed directly by the application */
+typedef struct
+{
+    uint8_t*                arena;          /**< Memory provided by the application */
+    uint32_t                size;           /**< Size of the arena */
+    uint32_t                used;           /**< Bytes of the arena allocated */
+} cy_JSON_dom_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Initialize a JSON DOM with the arena its nodes are allocated from
+ *
+ * Memory is never released to the arena, except by initializing the DOM again, which invalidates all its nodes.
+ *
+ * @param[out] dom   : Pointer to the JSON DOM
+ * @param[in]  arena : Memory provided by the application
+ * @param[in]  size  : Size of the arena
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_init( cy_JSON_dom_t* dom, void* arena, uint32_t size );
+
+/** Parse a JSON document into a tree of nodes
+ *
+ * The JSON document must be complete in `json_input`. The tree needs one node per value, and a copy of the member names
+ * and strings containing escape sequences.
+ *
+ * The nodes are allocated from the arena, but the document is parsed with a parser context on the stack of the caller,
+ * of sizeof( cy_JSON_parser_ctx_t ) bytes: about 1 KB with the default CY_JSON_MAX_DEPTH of 8.
+ *
+ * @param[in]  dom          : Pointer to an initialized JSON DOM
+ * @param[in]  json_input   : Pointer to the JSON document
+ * @param[in]  input_length : Length of the JSON document
+ * @param[out] root         : Set to the root node of the tree
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than CY_JSON_MAX_DEPTH
+ *                    - CY_RSLT_JSON_INCOMPLETE if the JSON document is truncated
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed, or followed by another one
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_parse( cy_JSON_dom_t* dom, const char* json_input, uint32_t input_length, cy_JSON_node_t** root );
+
+/** Look up a member of an object
+ *
+ * @param[in]  object     : Pointer to an object node
+ * @param[in]  key        : Member name, decoded
+ * @param[in]  key_length : Length of the member name
+ * @param[out] member     : Set to the node of the member
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the object has no member with that name
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the node is not an object
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_get_member( const cy_JSON_node_t* object, const char* key, uint32_t key_length, cy_JSON_node_t** member );
+
+/** Look up an element of an array
+ *
+ * @param[in]  array    : Pointer to an array node
+ * @param[in]  position : Position of the element in the array, from 0
+ * @param[out] element  : Set to the node of the element
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the array has no element at that position
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the node is not an array
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_get_element( const cy_JSON_node_t* array, uint32_t position, cy_JSON_node_t** element );
+
+/** Create a string node
+ *
+ * The string is copied to the arena.
+ *
+ * @param[in]  dom    : Pointer to a JSON DOM
+ * @param[in]  value  : String in UTF-8, which need not be NUL terminated
+ * @param[in]  length : Length of the string
+ * @param[out] node   : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_string( cy_JSON_dom_t* dom, const char* value, uint32_t length, cy_JSON_node_t** node );
+
+/** Create a number node from a signed integer
+ *
+ * @param[in]  dom   : Pointer to a JSON DOM
+ * @param[in]  value : Value
+ * @param[out] node  : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_int64( cy_JSON_dom_t* dom, int64_t value, cy_JSON_node_t** node );
+
+/** Create a number node from an unsigned integer
+ *
+ * @param[in]  dom   : Pointer to a JSON DOM
+ * @param[in]  value : Value
+ * @param[out] node  : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_uint64( cy_JSON_dom_t* dom, uint64_t value, cy_JSON_node_t** node );
+
+/** Create a number node from a double
+ *
+ * @param[in]  dom   : Pointer to a JSON DOM
+ * @param[in]  value : Value, which must be finite
+ * @param[out] node  : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_double( cy_JSON_dom_t* dom, double value, cy_JSON_node_t** node );
+
+/** Create a true or false node
+ *
+ * @param[in]  dom   : Pointer to a JSON DOM
+ * @param[in]  value : Value
+ * @param[out] node  : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_bool( cy_JSON_dom_t* dom, bool value, cy_JSON_node_t** node );
+
+/** Create a null, empty object or empty array node
+ *
+ * @param[in]  dom  : Pointer to a JSON DOM
+ * @param[in]  type : JSON_NULL_TYPE, JSON_OBJECT_TYPE or JSON_ARRAY_TYPE
+ * @param[out] node : Set to the new node
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_new_node( cy_JSON_dom_t* dom, cy_JSON_type_t type, cy_JSON_node_t** node );
+
+/** Set a member of an object
+ *
+ * When the object has a member with that name, its node is replaced by the given node, in the same position.
+ * Otherwise the node is added as the last member of the object, and the name is copied to the arena.
+ * The node must not be part of a tree already.
+ *
+ * @param[in] dom        : Pointer to the JSON DOM of the object
+ * @param[in] object     : Pointer to an object node
+ * @param[in] key        : Member name, decoded
+ * @param[in] key_length : Length of the member name
+ * @param[in] node       : Pointer to the new value of the member
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the arena is full
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the node is not an object
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_set_member( cy_JSON_dom_t* dom, cy_JSON_node_t* object, const char* key, uint32_t key_length, cy_JSON_node_t* node );
+
+/** Delete a member of an object
+ *
+ * The memory of the member is not released to the arena.
+ *
+ * @param[in] object     : Pointer to an object node
+ * @param[in] key        : Member name, decoded
+ * @param[in] key_length : Length of the member name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the object has no member with that name
+ *                    - CY_RSLT_JSON_TYPE_MISMATCH if the node is not an object
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_delete_member( cy_JSON_node_t* object, const char* key, uint32_t key_length );
+
+/** Add an element at the end of an array
+ *
+ * The node must not be part of a tree already.
+ *
+ * @param[in] array : Pointer to an array node
+ * @param[in] node  : Pointer to the new element
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_TYPE_MISMATCH if the node is not an array
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_append_element( cy_JSON_node_t* array, cy_JSON_node_t* node );
+
+/** Write a node and all its descendants as a JSON value
+ *
+ * The member name of the node itself is not written. To write a whole document, write its root node to an initialized
+ * writer, then call @ref cy_JSON_writer_finish.
+ *
+ * @param[in] node   : Pointer to the node
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error returned by the writer functions
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_dom_write( const cy_JSON_node_t* node, cy_JSON_writer_t* writer );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
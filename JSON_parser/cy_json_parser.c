@@ -35,6 +35,9 @@
  *
  */
 #include "cy_json_parser.h"
+#include "cy_json_scan.h"
+#include "cy_json_parser_private.h"
+#include <float.h>
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
@@ -42,21 +45,134 @@
  *                      Macros
  ******************************************************/
 
-#define MAX_BACKUP_SIZE 500
-#define MAX_PARENTS 4
+/** Size of the token buffer used by the default parser context */
+#ifndef CY_JSON_TOKEN_BUFFER_SIZE
+#define CY_JSON_TOKEN_BUFFER_SIZE      (500)
+#endif
+
+#define JSON_IS_DIGIT( ch )            ( ( ( ch ) >= '0' ) && ( ( ch ) <= '9' ) )
+
+#define JSON_IS_HEX_DIGIT( ch )        ( JSON_IS_DIGIT( ch ) || ( ( ( ch ) >= 'a' ) && ( ( ch ) <= 'f' ) ) || ( ( ( ch ) >= 'A' ) && ( ( ch ) <= 'F' ) ) )
+
+/* Add to a counter of the statistics of the context, if it has any */
+#define JSON_STATISTICS_ADD( ctx, counter, value ) \
+    do { if ( ( ctx )->statistics != NULL ) { ( ctx )->statistics->counter += ( value ); } } while ( 0 )
+
+/* The fast path of the number conversion relies on double arithmetic being rounded to double precision,
+ * which is not the case with the x87 FPU
+ */
+#if defined( FLT_EVAL_METHOD ) && ( FLT_EVAL_METHOD != 0 ) && ( FLT_EVAL_METHOD != 1 )
+#define JSON_NUMBER_FAST_PATH          (0)
+#else
+#define JSON_NUMBER_FAST_PATH          (1)
+#endif
 
 /******************************************************
  *                    Constants
  ******************************************************/
 
+/* Largest mantissa and power of ten exactly represented by a double */
+#define JSON_NUMBER_MAX_EXACT_MANTISSA     (9007199254740992ULL)
+#define JSON_NUMBER_MAX_EXACT_POWER        (22)
+
+/* Exponents are accumulated up to this value, far beyond the range of a double */
+#define JSON_NUMBER_MAX_EXPONENT           (100000UL)
+
+/* Significant digits of a number kept by the exact conversion. The halfway points between doubles have at most 767
+ * significant digits: of the digits beyond, only whether they are all zeros matters
+ */
+#define JSON_NUMBER_MAX_DIGITS             (768)
+
+/* Words of the big integers of the exact conversion: enough for 769 digits, or for 5^1092 times a 54-bit mantissa */
+#define JSON_NUMBER_BIGNUM_WORDS           (84)
+
+/* Numbers of 10^310 and above are infinite, numbers below 10^-324 round to zero */
+#define JSON_NUMBER_MAX_DECIMAL_EXPONENT   (310)
+#define JSON_NUMBER_MIN_DECIMAL_EXPONENT   (-323)
+
+/* Largest power of five held by a uint32_t */
+#define JSON_NUMBER_MAX_POWER_OF_FIVE      (13)
+#define JSON_NUMBER_POWER_OF_FIVE          (1220703125UL)
+
+/* Powers of ten in json_binary_powers_of_ten, enough for the decimal exponents of the mantissa of finite doubles */
+#define JSON_NUMBER_BINARY_POWERS          (9)
+
+/* Digits are loaded into a big integer nine at a time, the most a uint32_t holds */
+#define JSON_NUMBER_DIGITS_FACTOR          (1000000000UL)
+
+/* Representation of doubles: mantissa bits, exponent of the smallest subnormal, largest finite double and infinity */
+#define JSON_DOUBLE_MANTISSA_BITS          (52)
+#define JSON_DOUBLE_MIN_EXPONENT           (-1074)
+#define JSON_DOUBLE_MAX_BITS               (0x7FEFFFFFFFFFFFFFULL)
+#define JSON_DOUBLE_INFINITY_BITS          (0x7FF0000000000000ULL)
+
+/* Longest fragment of a string value, bounded by the value_length of cy_JSON_object_t */
+#define JSON_FRAGMENT_MAX_LENGTH           (0xFFFFUL)
+
+/* Magnitude of INT64_MIN */
+#define JSON_NUMBER_INT64_MIN_MAGNITUDE    (9223372036854775808ULL)
+
+#ifdef CY_JSON_FIXED_POINT
+/* Magnitude of INT32_MIN */
+#define JSON_NUMBER_INT32_MIN_MAGNITUDE    (2147483648ULL)
+
+/* Largest power of ten held by a uint64_t */
+#define JSON_NUMBER_MAX_INTEGER_POWER      (19)
+
+/* Decimals of a number kept to compute fixedval */
+#define JSON_NUMBER_MAX_FIXED_DECIMALS     (18)
+#endif
+
 /******************************************************
  *                   Enumerations
  ******************************************************/
 
+/* Parser states. The state is kept in the parser context, so parsing can be suspended at the end of
+ * any input buffer and resumed with the next one.
+ */
+typedef enum
+{
+    JSON_STATE_START = 0,          /* Waiting for the start of a JSON document */
+    JSON_STATE_KEY_OR_END,         /* After '{' : expecting a member name or '}' */
+    JSON_STATE_KEY,                /* After ',' in an object : expecting a member name */
+    JSON_STATE_COLON,              /* After a member name : expecting ':' */
+    JSON_STATE_VALUE_OR_END,       /* After '[' : expecting a value or ']' */
+    JSON_STATE_VALUE,              /* Expecting a value */
+    JSON_STATE_COMMA_OR_END,       /* After a value : expecting ',' or the end of the container */
+    JSON_STATE_STRING,             /* Inside a string */
+    JSON_STATE_STRING_ESCAPE,      /* After '\' inside a string */
+    JSON_STATE_STRING_UNICODE,     /* Inside the hex digits of a \uXXXX escape sequence */
+    JSON_STATE_NUMBER,             /* Inside a number */
+    JSON_STATE_LITERAL,            /* Inside true, false or null */
+    JSON_STATE_SKIP,               /* Inside an object or array skipped without parsing */
+    JSON_STATE_SKIP_STRING,        /* Inside a string of a skipped object or array */
+    JSON_STATE_SKIP_ESCAPE         /* After '\' inside a string of a skipped object or array */
+} json_parser_state_t;
+
+/* Number grammar states, kept in the parser context while in JSON_STATE_NUMBER */
+typedef enum
+{
+    JSON_NUMBER_MINUS = 0,         /* After '-' */
+    JSON_NUMBER_ZERO,              /* After a leading '0' */
+    JSON_NUMBER_INTEGER,           /* Inside the integer part */
+    JSON_NUMBER_POINT,             /* After '.' */
+    JSON_NUMBER_FRACTION,          /* Inside the fraction part */
+    JSON_NUMBER_EXPONENT,          /* After 'e' or 'E' */
+    JSON_NUMBER_EXPONENT_SIGN,     /* After the sign of the exponent */
+    JSON_NUMBER_EXPONENT_DIGITS    /* Inside the exponent digits */
+} json_number_state_t;
+
 /******************************************************
  *                 Type Definitions
  ******************************************************/
 
+/* Unsigned big integer of the exact number conversion, least significant word first, without leading zero words */
+typedef struct
+{
+    uint32_t length;                               /* Number of words in use */
+    uint32_t words[ JSON_NUMBER_BIGNUM_WORDS ];    /* Words of the integer */
+} json_bignum_t;
+
 /******************************************************
  *                    Structures
  ******************************************************/
@@ -65,78 +181,70 @@
  *               Static Function Declarations
  ******************************************************/
 
-static cy_rslt_t validate_array_value( char* start, char* stop, uint8_t len );
+static void json_parser_reset_state( cy_JSON_parser_ctx_t* ctx );
 
 /******************************************************
  *               Variable Definitions
  ******************************************************/
-static cy_JSON_callback_t      internal_json_callback;
-static void                    *internal_json_argument;
-
-static char*               previous_token   = NULL;
-static cy_JSON_object_t json_object =
-{
-    .object_string        = NULL,
-    .object_string_length = 0,
-    .value_type           = UNKNOWN_JSON_TYPE,
-    .value                = NULL,
-    .value_length         = 0,
-    .intval               = 0,
-    .floatval             = 0.0,
-    .boolval              = true,
-    .parent_object        = NULL
-};
-
-static int32_t             parent_counter = 0;
-static cy_JSON_object_t parent_json_object[ MAX_PARENTS ];
-
-static bool        incomplete_response       = false;
-
-static int32_t             object_counter            = 0;
-
-static char*               string_start              = NULL;
-static char*               string_end                = NULL;
-
-static char*               value_start               = NULL;
-static char*               value_end                 = NULL;
+static char default_token_buffer[ CY_JSON_TOKEN_BUFFER_SIZE ];
 
-static cy_JSON_type_t      type                      = UNKNOWN_JSON_TYPE;
-
-static char*               current_input_token;
-static char*               end_of_input;
+/* Context used by the legacy cy_JSON_parser_register_callback()/cy_JSON_parser() API */
+static cy_JSON_parser_ctx_t default_json_parser_ctx =
+{
+    .json_object =
+    {
+        .object_string        = NULL,
+        .object_string_length = 0,
+        .value_type           = UNKNOWN_JSON_TYPE,
+        .value                = NULL,
+        .value_length         = 0,
+        .intval               = 0,
+        .floatval             = 0.0,
+        .boolval              = true,
+        .parent_object        = NULL
+    },
+    .levels                   = default_json_parser_ctx.default_levels,
+    .max_depth                = CY_JSON_MAX_DEPTH,
+    .token_buffer             = default_token_buffer,
+    .token_buffer_size        = sizeof( default_token_buffer )
+};
 
-static char*               most_recent_object_marker = NULL;
+static const char json_true_literal[]  = "true";
+static const char json_false_literal[] = "false";
+static const char json_null_literal[]  = "null";
 
-char                       packet_backup[ MAX_BACKUP_SIZE ];
+#if JSON_NUMBER_FAST_PATH
+static const double json_powers_of_ten[ JSON_NUMBER_MAX_EXACT_POWER + 1 ] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
 
-uint32_t                   number_of_bytes_backed_up;
+/* 10^( 2^i ), to approximate the numbers the exact conversion then corrects */
+static const double json_binary_powers_of_ten[ JSON_NUMBER_BINARY_POWERS ] =
+{
+    1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256
+};
 
-static bool        escape_token              = false;
-static int32_t             array_counter            = 0;
+#ifdef CY_JSON_FIXED_POINT
+static const uint64_t json_integer_powers_of_ten[ JSON_NUMBER_MAX_INTEGER_POWER + 1 ] =
+{
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+    10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+#endif
 
 /******************************************************
  *               Function Definitions
  ******************************************************/
- /* This function converts a string to appropriate format if the type is either
-  * a JSON_NUMBER_TYPE or JSON_BOOLEAN_TYPE
+ /* This function converts a string to appropriate format if the type is
+  * JSON_BOOLEAN_TYPE. Numbers are converted as they are parsed, see json_number_convert()
   */
 static void str_convertor( cy_JSON_object_t* json_object )
 {
-    if( json_object->value_type == JSON_NUMBER_TYPE )
-    {
-        int i = 0;
-        for( i=0; i<json_object->value_length; i++ )
-        {
-            if( json_object->value[i] == '.' )
-            {
-                json_object->floatval = strtof( json_object->value, NULL );
-                json_object->value_type = JSON_FLOAT_TYPE;
-                return;
-            }
-        }
-        json_object->intval = strtol( json_object->value, NULL, 10 );
-    }
-    else if( json_object->value_type == JSON_BOOLEAN_TYPE )
+    if( json_object->value_type == JSON_BOOLEAN_TYPE )
     {
         if( json_object->value[0] == 't' )
         {
@@ -148,953 +256,2487 @@ static void str_convertor( cy_JSON_object_t* json_object )
         }
     }
 }
-static cy_rslt_t validate_array_value( char* start, char* stop, uint8_t len )
+
+/* Accumulate a digit of the integer or fraction part of a number. Digits which do not fit in the
+ * mantissa are dropped and accounted for in the exponent.
+ */
+static inline void json_number_digit( cy_JSON_number_t* number, char ch, bool fraction )
 {
-    char*   temp = NULL;
-    uint8_t e_count = 0;
-    uint8_t dot = 0;
-    uint8_t minus = 0;
-    uint8_t plus = 0;
+    uint32_t digit = (uint32_t)( ch - '0' );
+
+    if ( number->mantissa <= ( ( UINT64_MAX - digit ) / 10 ) )
+    {
+        number->mantissa = ( number->mantissa * 10 ) + digit;
+        number->exponent -= ( fraction ) ? 1 : 0;
+    }
+    else
+    {
+        number->exponent  += ( fraction ) ? 0 : 1;
+        number->truncated |= ( digit != 0 );
+    }
+}
 
-    /* TODO : Cases to be handled for example : e+-  e.+1  .e-+2  -1.234e-3  */
+/* Advance the number grammar by one character, accumulating the value of the number.
+ * Returns false if the character is not part of the number.
+ */
+static bool json_number_next( cy_JSON_parser_ctx_t* ctx, char ch )
+{
+    cy_JSON_number_t* number = &ctx->number;
 
-    if ( ( *start == 'f' ) && ( len == 5 ) )
+    switch ( ctx->sub_state )
     {
-        if ( !strncmp( (const char*) start, "false", ( sizeof( "false" ) - 1 ) ) )
-        {
-            return CY_RSLT_SUCCESS;
-        }
-        else
-        {
-            return CY_RSLT_JSON_GENERIC_ERROR;
-        }
+        case JSON_NUMBER_MINUS:
+            if ( ch == '0' )
+            {
+                ctx->sub_state = JSON_NUMBER_ZERO;
+                return true;
+            }
+            if ( JSON_IS_DIGIT( ch ) )
+            {
+                json_number_digit( number, ch, false );
+                ctx->sub_state = JSON_NUMBER_INTEGER;
+                return true;
+            }
+            return false;
+
+        case JSON_NUMBER_INTEGER:
+            if ( JSON_IS_DIGIT( ch ) )
+            {
+                json_number_digit( number, ch, false );
+                return true;
+            }
+            /* Fall through - check for a fraction or an exponent */
+        case JSON_NUMBER_ZERO:
+            if ( ch == '.' )
+            {
+                ctx->sub_state = JSON_NUMBER_POINT;
+                return true;
+            }
+            if ( ( ch == 'e' ) || ( ch == 'E' ) )
+            {
+                ctx->sub_state = JSON_NUMBER_EXPONENT;
+                return true;
+            }
+            return false;
+
+        case JSON_NUMBER_POINT:
+            if ( JSON_IS_DIGIT( ch ) )
+            {
+                json_number_digit( number, ch, true );
+                ctx->sub_state = JSON_NUMBER_FRACTION;
+                return true;
+            }
+            return false;
+
+        case JSON_NUMBER_FRACTION:
+            if ( JSON_IS_DIGIT( ch ) )
+            {
+                json_number_digit( number, ch, true );
+                return true;
+            }
+            if ( ( ch == 'e' ) || ( ch == 'E' ) )
+            {
+                ctx->sub_state = JSON_NUMBER_EXPONENT;
+                return true;
+            }
+            return false;
+
+        case JSON_NUMBER_EXPONENT:
+            if ( ( ch == '+' ) || ( ch == '-' ) )
+            {
+                number->exponent_negative = ( ch == '-' );
+                ctx->sub_state            = JSON_NUMBER_EXPONENT_SIGN;
+                return true;
+            }
+            /* Fall through - check for the first exponent digit */
+        case JSON_NUMBER_EXPONENT_SIGN:
+        case JSON_NUMBER_EXPONENT_DIGITS:
+        default:
+            if ( !JSON_IS_DIGIT( ch ) )
+            {
+                return false;
+            }
+            /* Any exponent beyond the range of a double saturates */
+            if ( number->explicit_exponent < JSON_NUMBER_MAX_EXPONENT )
+            {
+                number->explicit_exponent = ( number->explicit_exponent * 10 ) + (uint32_t)( ch - '0' );
+            }
+            ctx->sub_state = JSON_NUMBER_EXPONENT_DIGITS;
+            return true;
+    }
+}
+
+/* Decimal exponent of the mantissa of a number, including its exponent part */
+static inline int32_t json_number_exponent( const cy_JSON_number_t* number )
+{
+    return number->exponent + ( ( number->exponent_negative ) ? -(int32_t)number->explicit_exponent : (int32_t)number->explicit_exponent );
+}
+
+static void json_bignum_set( json_bignum_t* n, uint64_t value )
+{
+    for ( n->length = 0; value != 0; value >>= 32 )
+    {
+        n->words[ n->length++ ] = (uint32_t)value;
+    }
+}
+
+/* n = n * factor + addend */
+static void json_bignum_mul_add( json_bignum_t* n, uint32_t factor, uint32_t addend )
+{
+    uint64_t carry = addend;
+    uint32_t i;
+
+    for ( i = 0; i < n->length; i++ )
+    {
+        carry          += (uint64_t)n->words[ i ] * factor;
+        n->words[ i ]   = (uint32_t)carry;
+        carry         >>= 32;
     }
-    if ( ( *start == 't' ) && ( len == 4 ) )
+    if ( ( carry != 0 ) && ( n->length < JSON_NUMBER_BIGNUM_WORDS ) )
     {
-        if ( !strncmp( (const char*) start, "true", ( sizeof( "true" ) - 1 ) ) )
-        {
-            return CY_RSLT_SUCCESS;
-        }
-        else
+        n->words[ n->length++ ] = (uint32_t)carry;
+    }
+}
+
+/* n = n * 5^exponent */
+static void json_bignum_mul_pow5( json_bignum_t* n, uint32_t exponent )
+{
+    uint32_t factor = 1;
+
+    for ( ; exponent >= JSON_NUMBER_MAX_POWER_OF_FIVE; exponent -= JSON_NUMBER_MAX_POWER_OF_FIVE )
+    {
+        json_bignum_mul_add( n, JSON_NUMBER_POWER_OF_FIVE, 0 );
+    }
+    for ( ; exponent > 0; exponent-- )
+    {
+        factor *= 5;
+    }
+    json_bignum_mul_add( n, factor, 0 );
+}
+
+/* n = n * 2^shift */
+static void json_bignum_shift_left( json_bignum_t* n, uint32_t shift )
+{
+    uint32_t words = shift / 32;
+    uint32_t bits  = shift % 32;
+    uint32_t top;
+    uint32_t i;
+
+    if ( n->length == 0 )
+    {
+        return;
+    }
+    if ( ( n->length + words ) >= JSON_NUMBER_BIGNUM_WORDS )
+    {
+        /* Beyond the magnitudes compared by the exact conversion */
+        n->length = 0;
+        return;
+    }
+
+    top = ( bits == 0 ) ? 0 : ( n->words[ n->length - 1 ] >> ( 32 - bits ) );
+    for ( i = n->length - 1; i > 0; i-- )
+    {
+        n->words[ i + words ] = ( n->words[ i ] << bits ) | ( ( bits == 0 ) ? 0 : ( n->words[ i - 1 ] >> ( 32 - bits ) ) );
+    }
+    n->words[ words ] = n->words[ 0 ] << bits;
+    memset( n->words, 0x0, words * sizeof( n->words[ 0 ] ) );
+    n->length += words;
+    if ( top != 0 )
+    {
+        n->words[ n->length++ ] = top;
+    }
+}
+
+/* n = n / 2^shift, truncated. Returns true if non-zero bits were shifted out */
+static bool json_bignum_shift_right( json_bignum_t* n, uint32_t shift )
+{
+    uint32_t words = shift / 32;
+    uint32_t bits  = shift % 32;
+    bool     lost  = false;
+    uint32_t i;
+
+    if ( words >= n->length )
+    {
+        lost      = ( n->length != 0 );
+        n->length = 0;
+        return lost;
+    }
+
+    for ( i = 0; i < words; i++ )
+    {
+        lost |= ( n->words[ i ] != 0 );
+    }
+    lost |= ( bits != 0 ) && ( ( n->words[ words ] & ( ( 1UL << bits ) - 1 ) ) != 0 );
+
+    for ( i = words; i < n->length; i++ )
+    {
+        n->words[ i - words ] = ( n->words[ i ] >> bits ) | ( ( ( bits == 0 ) || ( ( i + 1 ) == n->length ) ) ? 0 : ( n->words[ i + 1 ] << ( 32 - bits ) ) );
+    }
+    n->length -= words;
+    while ( ( n->length != 0 ) && ( n->words[ n->length - 1 ] == 0 ) )
+    {
+        n->length--;
+    }
+
+    return lost;
+}
+
+static int json_bignum_compare( const json_bignum_t* a, const json_bignum_t* b )
+{
+    uint32_t i;
+
+    if ( a->length != b->length )
+    {
+        return ( a->length > b->length ) ? 1 : -1;
+    }
+    for ( i = a->length; i > 0; i-- )
+    {
+        if ( a->words[ i - 1 ] != b->words[ i - 1 ] )
         {
-            return CY_RSLT_JSON_GENERIC_ERROR;
+            return ( a->words[ i - 1 ] > b->words[ i - 1 ] ) ? 1 : -1;
         }
     }
-    if ( ( *start == 'n' ) && ( len == 4 ) )
+
+    return 0;
+}
+
+/* Load the significant digits of the text of a number into a big integer, up to JSON_NUMBER_MAX_DIGITS of them,
+ * followed by a 1 if the digits dropped are not all zeros. Returns the decimal exponent of the big integer, and sets
+ * count to its number of digits. The number must not be zero.
+ */
+static int32_t json_number_load_digits( const cy_JSON_number_t* number, const char* text, uint32_t length, json_bignum_t* digits, int32_t* count )
+{
+    int32_t  ordinal = 0;
+    int32_t  point   = -1;
+    int32_t  first   = -1;
+    int32_t  last    = 0;
+    int32_t  kept;
+    uint32_t chunk  = 0;
+    uint32_t factor = 1;
+    uint32_t i;
+
+    /* Positions of the decimal point and of the first and last non-zero digits, among the digits of the number */
+    for ( i = 0; i < length; i++ )
     {
-        if ( !strncmp( (const char*) start, "null", ( sizeof( "null" ) - 1 ) ) )
+        if ( text[ i ] == '.' )
         {
-            return CY_RSLT_SUCCESS;
+            point = ordinal;
         }
-        else
+        else if ( JSON_IS_DIGIT( text[ i ] ) )
         {
-            return CY_RSLT_JSON_GENERIC_ERROR;
+            if ( text[ i ] != '0' )
+            {
+                first = ( first < 0 ) ? ordinal : first;
+                last  = ordinal;
+            }
+            ordinal++;
+        }
+        else if ( text[ i ] != '-' )
+        {
+            break;
         }
     }
+    point = ( point < 0 ) ? ordinal : point;
+    kept  = last + 1 - first;
+    kept  = ( kept > JSON_NUMBER_MAX_DIGITS ) ? JSON_NUMBER_MAX_DIGITS : kept;
 
-    temp = start;
-    while ( temp <= stop )
+    json_bignum_set( digits, 0 );
+    for ( i = 0, ordinal = 0; ( i < length ) && ( ordinal < ( first + kept ) ); i++ )
     {
-        if( *temp == ' ')
+        if ( !JSON_IS_DIGIT( text[ i ] ) )
         {
-            temp++;
             continue;
         }
-        if( *temp == '\n')
+        if ( ordinal++ < first )
         {
-            temp++;
             continue;
         }
-        if( *temp == '\r')
+        chunk   = ( chunk * 10 ) + (uint32_t)( text[ i ] - '0' );
+        factor *= 10;
+        if ( factor == JSON_NUMBER_DIGITS_FACTOR )
         {
-            temp++;
-            continue;
+            json_bignum_mul_add( digits, factor, chunk );
+            chunk  = 0;
+            factor = 1;
         }
+    }
+    if ( factor != 1 )
+    {
+        json_bignum_mul_add( digits, factor, chunk );
+    }
 
-        switch ( *temp )
-        {
-            case 'e':
-                e_count++;
-                break;
+    *count = kept;
+    if ( kept < ( last + 1 - first ) )
+    {
+        json_bignum_mul_add( digits, 10, 1 );
+        ( *count )++;
+    }
 
-            case '+':
-                plus++;
-                break;
+    return point - ( first + *count ) + ( ( number->exponent_negative ) ? -(int32_t)number->explicit_exponent : (int32_t)number->explicit_exponent );
+}
 
-            case '-':
-                minus++;
-                break;
+/* Compare the number digits * 10^exponent, where digits already includes 5^exponent for positive exponents, with the
+ * point halfway between the double of the given representation and the next one. halfway is used as scratch space.
+ */
+static int json_number_compare_halfway( const json_bignum_t* digits, int32_t exponent, uint64_t bits, json_bignum_t* halfway )
+{
+    uint64_t mantissa = bits & ( ( 1ULL << JSON_DOUBLE_MANTISSA_BITS ) - 1 );
+    int32_t  binary   = (int32_t)( bits >> JSON_DOUBLE_MANTISSA_BITS );
+    int32_t  shift;
+    bool     lost     = false;
+    int      result;
 
-            case '.':
-                dot++;
-                break;
+    if ( binary == 0 )
+    {
+        binary = JSON_DOUBLE_MIN_EXPONENT;
+    }
+    else
+    {
+        mantissa |= ( 1ULL << JSON_DOUBLE_MANTISSA_BITS );
+        binary   += JSON_DOUBLE_MIN_EXPONENT - 1;
+    }
 
-            default:
-                break;
-        }
+    /* The halfway point is ( 2 * mantissa + 1 ) * 2^( binary - 1 ), and the number digits * 5^exponent * 2^exponent:
+     * both are multiplied by 5^-exponent for negative exponents, and by 2^-min( binary - 1, exponent )
+     */
+    json_bignum_set( halfway, ( 2 * mantissa ) + 1 );
+    if ( exponent < 0 )
+    {
+        json_bignum_mul_pow5( halfway, (uint32_t)-exponent );
+    }
+    shift = binary - 1 - exponent;
+    if ( shift >= 0 )
+    {
+        json_bignum_shift_left( halfway, (uint32_t)shift );
+    }
+    else
+    {
+        lost = json_bignum_shift_right( halfway, (uint32_t)-shift );
+    }
+
+    result = json_bignum_compare( digits, halfway );
+
+    /* Bits shifted out of the halfway point make it larger than the number if their integer parts are equal */
+    return ( ( result == 0 ) && lost ) ? -1 : result;
+}
+
+/* Magnitude of a number, correctly rounded whatever its number of digits, with integer arithmetic and without the C
+ * library, so independent of the locale. An approximation from the mantissa is corrected one double at a time,
+ * comparing the number with the halfway points between doubles as big integers (Clinger's AlgorithmR). The two big
+ * integers take less than 700 bytes of stack.
+ */
+static double json_number_exact( const cy_JSON_number_t* number, const char* text, uint32_t length )
+{
+    json_bignum_t digits;
+    json_bignum_t halfway;
+    int32_t       exponent;
+    int32_t       count;
+    int32_t       power = json_number_exponent( number );
+    uint32_t      magnitude;
+    double        value = (double)number->mantissa;
+    uint64_t      bits;
+    int           above;
+    int           below = 0;
+    uint32_t      i;
+
+    exponent = json_number_load_digits( number, text, length, &digits, &count );
+    if ( ( count + exponent ) >= JSON_NUMBER_MAX_DECIMAL_EXPONENT )
+    {
+        bits = JSON_DOUBLE_INFINITY_BITS;
+        memcpy( &value, &bits, sizeof( value ) );
+        return value;
+    }
+    if ( ( count + exponent ) < JSON_NUMBER_MIN_DECIMAL_EXPONENT )
+    {
+        return 0.0;
+    }
 
-        if ( !( ( ( *temp >= '0' ) && ( *temp <= '9' ) ) || ( *temp == 'e' ) || ( *temp == '-' ) || ( *temp == '.' ) || ( *temp == '+' ) ) )
+    /* Within a few units in the last place */
+    magnitude = ( power < 0 ) ? (uint32_t)-power : (uint32_t)power;
+    for ( i = 0; ( magnitude != 0 ) && ( i < JSON_NUMBER_BINARY_POWERS ); i++, magnitude >>= 1 )
+    {
+        if ( ( magnitude & 1 ) != 0 )
         {
-            return CY_RSLT_JSON_GENERIC_ERROR;
+            value = ( power < 0 ) ? ( value / json_binary_powers_of_ten[ i ] ) : ( value * json_binary_powers_of_ten[ i ] );
         }
+    }
+    memcpy( &bits, &value, sizeof( bits ) );
+    bits = ( bits > JSON_DOUBLE_MAX_BITS ) ? JSON_DOUBLE_MAX_BITS : bits;
+
+    if ( exponent > 0 )
+    {
+        json_bignum_mul_pow5( &digits, (uint32_t)exponent );
+    }
 
-        if ( ( e_count > 1 ) || ( minus > 1 ) || ( plus > 1 ) || ( dot > 1 ) )
+    /* Move up while the number is above the halfway point to the next double, or else down while it is below the
+     * halfway point to the previous one. A number on a halfway point rounds to the even mantissa.
+     */
+    above = json_number_compare_halfway( &digits, exponent, bits, &halfway );
+    if ( above > 0 )
+    {
+        do
         {
-            return CY_RSLT_JSON_GENERIC_ERROR;
+            bits++;
+        } while ( ( bits < JSON_DOUBLE_INFINITY_BITS ) && ( ( above = json_number_compare_halfway( &digits, exponent, bits, &halfway ) ) > 0 ) );
+        below = 1;
+    }
+    else
+    {
+        while ( ( bits > 0 ) && ( ( below = json_number_compare_halfway( &digits, exponent, bits - 1, &halfway ) ) < 0 ) )
+        {
+            bits--;
+            above = below;
         }
-        temp++;
+    }
+    if ( ( ( bits & 1 ) != 0 ) && ( bits < JSON_DOUBLE_INFINITY_BITS ) )
+    {
+        bits = ( above == 0 ) ? ( bits + 1 ) : ( ( below == 0 ) ? ( bits - 1 ) : bits );
     }
 
-    return CY_RSLT_SUCCESS;
+    memcpy( &value, &bits, sizeof( value ) );
+    return value;
 }
 
-
-/* Register callbacks parser will use to populate fields*/
-cy_rslt_t cy_JSON_parser_register_callback( cy_JSON_callback_t json_callback, void *arg )
+/* Set the doubleval and floatval fields of the JSON object. The double is exact: the fast path is only taken when
+ * the mantissa and the power of ten are both exact doubles, so a single rounding occurs (Clinger's algorithm). Other
+ * numbers, with more than 15 significant digits or a large exponent, are converted by json_number_exact(), from
+ * their text rather than with strtod(), which follows the LC_NUMERIC locale.
+ */
+static void json_number_floating( const cy_JSON_number_t* number, cy_JSON_object_t* json_object )
 {
-    internal_json_callback = json_callback;
-    internal_json_argument = arg;
+    int32_t exponent = json_number_exponent( number );
+    double  value;
 
-    return CY_RSLT_SUCCESS;
+    if ( number->mantissa == 0 )
+    {
+        value = 0.0;
+    }
+#if JSON_NUMBER_FAST_PATH
+    else if ( !number->truncated && ( number->mantissa <= JSON_NUMBER_MAX_EXACT_MANTISSA ) && ( exponent >= -JSON_NUMBER_MAX_EXACT_POWER ) && ( exponent <= JSON_NUMBER_MAX_EXACT_POWER ) )
+    {
+        value = (double)number->mantissa;
+        value = ( exponent < 0 ) ? ( value / json_powers_of_ten[ -exponent ] ) : ( value * json_powers_of_ten[ exponent ] );
+    }
+#endif
+    else
+    {
+        value = json_number_exact( number, json_object->value, json_object->value_length );
+    }
+    json_object->doubleval = ( number->negative ) ? -value : value;
+    json_object->floatval  = (float)json_object->doubleval;
 }
 
-
-/* Get current callback */
-cy_JSON_callback_t cy_JSON_parser_get_callback( void )
+#ifdef CY_JSON_FIXED_POINT
+/* Magnitude of mantissa * 10^exponent, truncated toward zero and saturated */
+static uint64_t json_number_scale( uint64_t mantissa, int32_t exponent )
 {
-    return internal_json_callback;
-}
+    if ( exponent < 0 )
+    {
+        return ( exponent < -JSON_NUMBER_MAX_INTEGER_POWER ) ? 0 : ( mantissa / json_integer_powers_of_ten[ -exponent ] );
+    }
+
+    for ( ; ( exponent > 0 ) && ( mantissa != 0 ); exponent-- )
+    {
+        if ( mantissa > ( UINT64_MAX / 10 ) )
+        {
+            return UINT64_MAX;
+        }
+        mantissa *= 10;
+    }
 
+    return mantissa;
+}
 
-cy_rslt_t cy_JSON_parser( const char* json_input, uint32_t input_length )
+/* Value of a number in the fixed-point format of fixedval, rounded to nearest and saturated, with integer arithmetic only */
+static int32_t json_number_fixed( const cy_JSON_number_t* number )
 {
-    cy_rslt_t valid_json_string         = CY_RSLT_SUCCESS;
-    int            space = 0;
-
-    if ( incomplete_response )
+    uint64_t mantissa = number->mantissa;
+    int32_t  exponent = json_number_exponent( number );
+    uint64_t magnitude;
+    uint64_t remainder;
+    uint64_t power;
+#ifndef CY_JSON_FIXED_POINT_DECIMALS
+    uint32_t i;
+#endif
+
+#ifdef CY_JSON_FIXED_POINT_DECIMALS
+    exponent += CY_JSON_FIXED_POINT_DECIMALS;
+#endif
+
+    if ( exponent >= 0 )
+    {
+        magnitude = json_number_scale( mantissa, exponent );
+#ifndef CY_JSON_FIXED_POINT_DECIMALS
+        magnitude = ( magnitude > ( UINT64_MAX >> CY_JSON_FIXED_POINT_FRACTION_BITS ) ) ? UINT64_MAX : ( magnitude << CY_JSON_FIXED_POINT_FRACTION_BITS );
+#endif
+    }
+    else
     {
-        // If there is enough room on backup buffer to hold new data and old backed up
-        // data, parse the backup buffer
-        if ( ( input_length + number_of_bytes_backed_up ) < MAX_BACKUP_SIZE )
+        /* Decimals beyond the 18th are below the resolution of fixedval. The remainder below then stays below 2^63 */
+        if ( exponent < -JSON_NUMBER_MAX_FIXED_DECIMALS )
         {
-            memcpy( packet_backup + number_of_bytes_backed_up, json_input, input_length );
-            current_input_token = packet_backup;
-            end_of_input = current_input_token + number_of_bytes_backed_up + input_length;
+            mantissa = json_number_scale( mantissa, exponent + JSON_NUMBER_MAX_FIXED_DECIMALS );
+            exponent = -JSON_NUMBER_MAX_FIXED_DECIMALS;
         }
-        else
+        power     = json_integer_powers_of_ten[ -exponent ];
+        magnitude = mantissa / power;
+        remainder = mantissa % power;
+
+#ifndef CY_JSON_FIXED_POINT_DECIMALS
+        /* Binary long division of the remainder, one fraction bit at a time */
+        magnitude = ( magnitude > ( UINT64_MAX >> CY_JSON_FIXED_POINT_FRACTION_BITS ) ) ? UINT64_MAX : ( magnitude << CY_JSON_FIXED_POINT_FRACTION_BITS );
+        for ( i = CY_JSON_FIXED_POINT_FRACTION_BITS; i > 0; i-- )
         {
-            // We must drop entire json object from last buffer. Find start of new json object
-            // in new packet, and being parsing from there
-            while ( *json_input != '{' )
+            remainder <<= 1;
+            if ( remainder >= power )
             {
-                json_input++;
-                input_length--;
+                remainder -= power;
+                magnitude |= ( 1ULL << ( i - 1 ) );
             }
-            current_input_token = (char*) json_input;
-            end_of_input        = current_input_token + input_length;
         }
+#endif
 
-        incomplete_response = false;
-    }
-    else
-    {
-        current_input_token = (char*) json_input;
-        end_of_input        = current_input_token + input_length;
-        previous_token = current_input_token;
+        /* Round half away from zero */
+        if ( ( remainder >= ( power - remainder ) ) && ( magnitude != UINT64_MAX ) )
+        {
+            magnitude++;
+        }
     }
 
-    while ( *( current_input_token ) == ' ' )
+    if ( number->negative )
     {
-        current_input_token++;
+        return ( magnitude >= JSON_NUMBER_INT32_MIN_MAGNITUDE ) ? INT32_MIN : -(int32_t)magnitude;
     }
-    previous_token = current_input_token;
+    return ( magnitude > (uint64_t)INT32_MAX ) ? INT32_MAX : (int32_t)magnitude;
+}
+#endif
+
+/* Set the numeric fields of the JSON object from the number just parsed. With CY_JSON_FIXED_POINT, doubleval and
+ * floatval are left to json_number_floating(), and no floating point operation is performed here.
+ */
+static void json_number_value( const cy_JSON_number_t* number, bool is_integer, cy_JSON_object_t* json_object )
+{
+    int32_t  exponent = json_number_exponent( number );
+#ifdef CY_JSON_FIXED_POINT
+    uint64_t magnitude;
+
+    json_object->fixedval  = json_number_fixed( number );
+    json_object->doubleval = 0.0;
+    json_object->floatval  = 0.0f;
+#else
+    double   value;
+
+    json_number_floating( number, json_object );
+#endif
+
+    /* Integers are exact as long as no digit was dropped from the mantissa, and fit unless they are below INT64_MIN */
+    json_object->exact_integer = is_integer && ( exponent == 0 ) && !( number->negative && ( number->mantissa > JSON_NUMBER_INT64_MIN_MAGNITUDE ) );
+    if ( is_integer && ( exponent == 0 ) )
+    {
+        json_object->uint64val = ( number->negative ) ? 0 : number->mantissa;
+        if ( number->negative )
+        {
+            json_object->int64val = ( number->mantissa >= JSON_NUMBER_INT64_MIN_MAGNITUDE ) ? INT64_MIN : -(int64_t)number->mantissa;
+        }
+        else
+        {
+            json_object->int64val = ( number->mantissa > (uint64_t)INT64_MAX ) ? INT64_MAX : (int64_t)number->mantissa;
+        }
+    }
+    else
+    {
+        /* Truncate toward zero, saturating */
+#ifdef CY_JSON_FIXED_POINT
+        magnitude              = json_number_scale( number->mantissa, exponent );
+        json_object->uint64val = ( number->negative ) ? 0 : magnitude;
+        if ( number->negative )
+        {
+            json_object->int64val = ( magnitude >= JSON_NUMBER_INT64_MIN_MAGNITUDE ) ? INT64_MIN : -(int64_t)magnitude;
+        }
+        else
+        {
+            json_object->int64val = ( magnitude > (uint64_t)INT64_MAX ) ? INT64_MAX : (int64_t)magnitude;
+        }
+#else
+        value = json_object->doubleval;
+        json_object->int64val  = ( value >= 9223372036854775807.0 ) ? INT64_MAX : ( ( value <= -9223372036854775808.0 ) ? INT64_MIN : (int64_t)value );
+        json_object->uint64val = ( value <= 0.0 ) ? 0 : ( ( value >= 18446744073709551615.0 ) ? UINT64_MAX : (uint64_t)value );
+#endif
+    }
+
+    json_object->value_type = ( is_integer ) ? JSON_NUMBER_TYPE : JSON_FLOAT_TYPE;
+    json_object->intval     = (uint32_t)json_object->int64val;
+}
+
+static void json_number_convert( cy_JSON_parser_ctx_t* ctx, cy_JSON_object_t* json_object )
+{
+    json_number_value( &ctx->number, ( ctx->sub_state == JSON_NUMBER_ZERO ) || ( ctx->sub_state == JSON_NUMBER_INTEGER ), json_object );
+}
+
+/* Accumulate the digits of an integer or fraction part, eight at a time while the mantissa has room for them */
+static const char* json_number_digits( cy_JSON_number_t* number, const char* position, const char* end, bool fraction )
+{
+    uint32_t value;
+
+    /* 10^11 * 10^8 is below 2^64 */
+    while ( ( ( end - position ) >= 8 ) && ( number->mantissa < 100000000000ULL ) && cy_json_scan_eight_digits( position, &value ) )
+    {
+        number->mantissa  = ( number->mantissa * 100000000ULL ) + value;
+        number->exponent -= ( fraction ) ? 8 : 0;
+        position         += 8;
+    }
+
+    while ( ( position < end ) && JSON_IS_DIGIT( *position ) )
+    {
+        json_number_digit( number, *position, fraction );
+        position++;
+    }
+
+    return position;
+}
+
+/* A number may only end after a digit */
+static bool json_number_is_complete( uint8_t state )
+{
+    return ( ( state == JSON_NUMBER_ZERO ) || ( state == JSON_NUMBER_INTEGER ) ||
+             ( state == JSON_NUMBER_FRACTION ) || ( state == JSON_NUMBER_EXPONENT_DIGITS ) );
+}
+
+static bool json_is_in_token_buffer( cy_JSON_parser_ctx_t* ctx, const char* data )
+{
+    return ( ( ctx->token_buffer != NULL ) && ( data >= ctx->token_buffer ) && ( data < ( ctx->token_buffer + ctx->token_buffer_size ) ) );
+}
+
+/* Append data to the token buffer, keeping one byte spare to NUL terminate completed tokens */
+static cy_rslt_t json_token_buffer_append( cy_JSON_parser_ctx_t* ctx, const char* data, uint32_t length )
+{
+    if ( ( ctx->token_buffer_used + length + 1 ) > ctx->token_buffer_size )
+    {
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+
+    memcpy( ctx->token_buffer + ctx->token_buffer_used, data, length );
+    ctx->token_buffer_used += length;
+
+    if ( ( ctx->statistics != NULL ) && ( length != 0 ) )
+    {
+        ctx->statistics->buffer_copies++;
+        ctx->statistics->buffer_bytes += length;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Returns the complete token ending at token_end. A token started in a previous input buffer is
+ * completed in the token buffer, otherwise it is returned in place.
+ */
+static cy_rslt_t json_token_complete( cy_JSON_parser_ctx_t* ctx, const char* input, const char* token_end, char** token, uint32_t* length )
+{
+    cy_rslt_t result;
+
+    if ( ctx->token_in_buffer )
+    {
+        result = json_token_buffer_append( ctx, input, (uint32_t)( token_end - input ) );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        ctx->token_buffer[ ctx->token_buffer_used ] = '\0';
+        ctx->token_in_buffer = false;
+
+        *token  = ctx->token_buffer + ctx->token_offset;
+        *length = ctx->token_buffer_used - ctx->token_offset;
+    }
+    else
+    {
+        *token  = ctx->token_start;
+        *length = (uint32_t)( token_end - ctx->token_start );
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Value of the four hexadecimal digits of a \uXXXX escape, or a value above 0xFFFF if they are not all hexadecimal */
+static uint32_t json_hex_value( const char* digits )
+{
+    uint32_t value = 0;
+    uint32_t i;
+    char     ch;
+
+    for ( i = 0; i < 4; i++ )
+    {
+        ch = digits[ i ];
+        if ( !JSON_IS_HEX_DIGIT( ch ) )
+        {
+            return 0x10000;
+        }
+        value = ( value << 4 ) | (uint32_t)( JSON_IS_DIGIT( ch ) ? ( ch - '0' ) : ( ( ch | 0x20 ) - 'a' + 10 ) );
+    }
+
+    return value;
+}
+
+/* Encode a character in UTF-8. Returns the number of bytes written, at most 4 */
+static uint32_t json_utf8_encode( uint32_t code_point, char* output )
+{
+    if ( code_point < 0x80 )
+    {
+        output[ 0 ] = (char)code_point;
+        return 1;
+    }
+    if ( code_point < 0x800 )
+    {
+        output[ 0 ] = (char)( 0xC0 | ( code_point >> 6 ) );
+        output[ 1 ] = (char)( 0x80 | ( code_point & 0x3F ) );
+        return 2;
+    }
+    if ( code_point < 0x10000 )
+    {
+        output[ 0 ] = (char)( 0xE0 | ( code_point >> 12 ) );
+        output[ 1 ] = (char)( 0x80 | ( ( code_point >> 6 ) & 0x3F ) );
+        output[ 2 ] = (char)( 0x80 | ( code_point & 0x3F ) );
+        return 3;
+    }
+    output[ 0 ] = (char)( 0xF0 | ( code_point >> 18 ) );
+    output[ 1 ] = (char)( 0x80 | ( ( code_point >> 12 ) & 0x3F ) );
+    output[ 2 ] = (char)( 0x80 | ( ( code_point >> 6 ) & 0x3F ) );
+    output[ 3 ] = (char)( 0x80 | ( code_point & 0x3F ) );
+    return 4;
+}
+
+/* Continue the FNV-1a hash of a path with the given characters */
+static uint32_t json_path_hash_update( uint32_t hash, const char* data, uint32_t length )
+{
+    while ( length-- > 0 )
+    {
+        hash = ( hash ^ (uint8_t)*data++ ) * CY_JSON_PATH_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/* Compute the hash of the path of the value starting, from the hash of its container and its member name or position */
+static void json_path_hash_start( cy_JSON_parser_ctx_t* ctx )
+{
+    cy_JSON_parser_level_t* level;
+    char                    index[ 12 ];
+    uint32_t                position;
+    uint32_t                i = sizeof( index );
+    uint32_t                hash;
+
+    if ( ctx->depth == 0 )
+    {
+        ctx->path_hash = CY_JSON_PATH_HASH_INIT;
+        return;
+    }
+
+    level = &ctx->levels[ ctx->depth - 1 ];
+    hash  = level->record.path_hash;
+
+    if ( level->container == OBJECT_START_TOKEN )
+    {
+        /* Member names are separated by '.', except at the start of the path */
+        if ( ctx->depth > 1 )
+        {
+            hash = json_path_hash_update( hash, ".", 1 );
+        }
+        hash = json_path_hash_update( hash, ctx->key, ctx->key_length );
+    }
+    else if ( ( ctx->options & CY_JSON_OPTION_PATH_HASH_INDEX ) != 0 )
+    {
+        index[ --i ] = ']';
+        position     = level->count - 1;
+        do
+        {
+            index[ --i ] = (char)( '0' + ( position % 10 ) );
+            position    /= 10;
+        } while ( position != 0 );
+        index[ --i ] = '[';
+
+        hash = json_path_hash_update( hash, &index[ i ], sizeof( index ) - i );
+    }
+    else
+    {
+        hash = json_path_hash_update( hash, "[*]", 3 );
+    }
+
+    ctx->path_hash = hash;
+}
+
+/* Match the value being parsed against the subscribed paths. Returns the paths ending at the value; the paths
+ * which continue below the value, if it is an object or an array, are returned in below.
+ */
+static uint32_t json_path_match( cy_JSON_parser_ctx_t* ctx, uint32_t* below )
+{
+    cy_JSON_parser_level_t*       level;
+    const cy_JSON_path_segment_t* segment;
+    uint32_t                      candidates;
+    uint32_t                      position;
+    uint32_t                      complete = 0;
+    uint32_t                      i;
+    bool                          match;
+
+    /* Every path starts at the document root */
+    if ( ctx->depth == 0 )
+    {
+        *below = ( ctx->path_count >= CY_JSON_MAX_PATHS ) ? 0xFFFFFFFFUL : ( ( 1UL << ctx->path_count ) - 1 );
+        return 0;
+    }
+
+    *below     = 0;
+    level      = &ctx->levels[ ctx->depth - 1 ];
+    position   = level->count - 1;
+    candidates = level->paths;
+
+    for ( i = 0; candidates != 0; i++, candidates >>= 1 )
+    {
+        if ( ( candidates & 1 ) == 0 )
+        {
+            continue;
+        }
+
+        segment = &ctx->paths[ i ].segments[ ctx->depth - 1 ];
+        if ( level->container == OBJECT_START_TOKEN )
+        {
+            match = ( segment->key != NULL ) && ( ( segment->index == CY_JSON_PATH_ANY ) ||
+                    ( ( segment->key_length == ctx->key_length ) && ( memcmp( segment->key, ctx->key, ctx->key_length ) == 0 ) ) );
+        }
+        else
+        {
+            match = ( segment->key == NULL ) && ( ( segment->index == CY_JSON_PATH_ANY ) || ( segment->index == position ) );
+        }
+
+        if ( match )
+        {
+            if ( ctx->paths[ i ].segment_count == ctx->depth )
+            {
+                complete |= ( 1UL << i );
+            }
+            else
+            {
+                *below |= ( 1UL << i );
+            }
+        }
+    }
+
+    return complete;
+}
+
+/* Invoke the callbacks of the given subscribed paths. Returns CY_RSLT_JSON_SKIP if any callback asked for it,
+ * or the first other result which is not CY_RSLT_SUCCESS
+ */
+static cy_rslt_t json_path_report( cy_JSON_parser_ctx_t* ctx, uint32_t paths )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    cy_rslt_t callback_result;
+    uint32_t  i;
+
+    if ( ctx->json_object.value_type == JSON_NUMBER_TYPE )
+    {
+        json_number_convert( ctx, &ctx->json_object );
+    }
+    str_convertor( &ctx->json_object );
+
+    for ( i = 0; paths != 0; i++, paths >>= 1 )
+    {
+        if ( ( ( paths & 1 ) != 0 ) && ( ctx->paths[ i ].callback != NULL ) )
+        {
+            JSON_STATISTICS_ADD( ctx, callbacks, 1 );
+            callback_result = ctx->paths[ i ].callback( &ctx->json_object, ctx->paths[ i ].argument );
+            if ( callback_result == CY_RSLT_JSON_SKIP )
+            {
+                result = CY_RSLT_JSON_SKIP;
+            }
+            else if ( callback_result != CY_RSLT_SUCCESS )
+            {
+                return callback_result;
+            }
+        }
+    }
+
+    return result;
+}
+
+/* Report a value to the registered callback, to the callbacks of the matching subscribed paths,
+ * or to the event handler when one is installed
+ */
+static cy_rslt_t json_report_value( cy_JSON_parser_ctx_t* ctx, cy_JSON_type_t type, char* value, uint32_t length )
+{
+    cy_JSON_object_t* json_object = &ctx->json_object;
+    uint32_t          complete;
+    uint32_t          below;
+
+    json_object->object_string        = ctx->key;
+    json_object->object_string_length = (uint8_t)ctx->key_length;
+    json_object->value_type           = type;
+    json_object->value                = value;
+    json_object->value_length         = (uint16_t)length;
+    json_object->parent_object        = ( ctx->depth ) ? ctx->levels[ ctx->depth - 1 ].member_parent : NULL;
+    json_object->fragment             = ctx->fragment;
+    json_object->path_hash            = ctx->path_hash;
+    ctx->value_length                 = length;
+
+    if ( ctx->event_handler != NULL )
+    {
+        return ctx->event_handler( ctx, CY_JSON_EVENT_VALUE, json_object, ctx->event_argument );
+    }
+
+    if ( ctx->paths != NULL )
+    {
+        complete = json_path_match( ctx, &below );
+        if ( complete != 0 )
+        {
+            return json_path_report( ctx, complete );
+        }
+    }
+    else if ( ctx->callback != NULL )
+    {
+        if ( type == JSON_NUMBER_TYPE )
+        {
+            json_number_convert( ctx, json_object );
+        }
+        str_convertor( json_object );
+        JSON_STATISTICS_ADD( ctx, callbacks, 1 );
+        return ctx->callback( json_object, ctx->argument );
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Release the member name and the token of a value which has been reported */
+static void json_release_value( cy_JSON_parser_ctx_t* ctx )
+{
+    ctx->key               = NULL;
+    ctx->key_length        = 0;
+    ctx->token_buffer_used = ctx->stack_used;
+    ctx->fragment          = CY_JSON_FRAGMENT_NONE;
+    ctx->fragmented        = false;
+}
+
+/* Close the innermost container without parsing the rest of its contents */
+static void json_skip_innermost( cy_JSON_parser_ctx_t* ctx )
+{
+    cy_JSON_parser_level_t* level = &ctx->levels[ ctx->depth - 1 ];
+
+    ctx->stack_used        = level->mark;
+    ctx->token_buffer_used = level->mark;
+    ctx->depth--;
+
+    ctx->skip_depth = 1;
+    ctx->state      = JSON_STATE_SKIP;
+}
+
+/* Report a complete string, number or literal, then expect a comma or the end of its container */
+static cy_rslt_t json_value_complete( cy_JSON_parser_ctx_t* ctx, cy_JSON_type_t type, char* value, uint32_t length )
+{
+    cy_rslt_t result;
+
+    JSON_STATISTICS_ADD( ctx, tokens[ type ], 1 );
+
+    result = json_report_value( ctx, type, value, length );
+    json_release_value( ctx );
+    ctx->state = JSON_STATE_COMMA_OR_END;
+
+    /* The rest of the container holding the value is not wanted */
+    if ( result == CY_RSLT_JSON_SKIP )
+    {
+        json_skip_innermost( ctx );
+        return CY_RSLT_SUCCESS;
+    }
+
+    return result;
+}
+
+/* Length of the first fragment of a part of a string value, at most JSON_FRAGMENT_MAX_LENGTH bytes.
+ * Escape sequences are not split, unless they have already been decoded.
+ */
+static uint32_t json_fragment_length( cy_JSON_parser_ctx_t* ctx, const char* data, uint32_t length )
+{
+    const char* escape;
+    uint32_t    step;
+    uint32_t    span;
+    uint32_t    i = 0;
+
+    if ( length <= JSON_FRAGMENT_MAX_LENGTH )
+    {
+        return length;
+    }
+    if ( !ctx->string_escaped || ( ( ctx->options & CY_JSON_OPTION_DECODE_ESCAPES ) != 0 ) )
+    {
+        return JSON_FRAGMENT_MAX_LENGTH;
+    }
+
+    while ( ( escape = memchr( data + i, ESCAPE_TOKEN, JSON_FRAGMENT_MAX_LENGTH - i ) ) != NULL )
+    {
+        i    = (uint32_t)( escape - data );
+        step = ( data[ i + 1 ] == 'u' ) ? 6 : 2;
+
+        /* A high surrogate stays with the escape sequence which may follow it */
+        span = ( ( step == 6 ) && ( ( json_hex_value( data + i + 2 ) & 0xFC00 ) == 0xD800 ) ) ? 12 : step;
+        if ( ( i + span ) > JSON_FRAGMENT_MAX_LENGTH )
+        {
+            return i;
+        }
+        i += step;
+    }
+
+    return JSON_FRAGMENT_MAX_LENGTH;
+}
+
+/* A top-level object or array is complete. The next one may follow */
+static cy_rslt_t json_record_complete( cy_JSON_parser_ctx_t* ctx )
+{
+    ctx->state = JSON_STATE_START;
+
+    if ( ctx->record_callback != NULL )
+    {
+        JSON_STATISTICS_ADD( ctx, callbacks, 1 );
+        return ctx->record_callback( ctx->record_count++, ctx->record_argument );
+    }
+    ctx->record_count++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Report part of a string value in fragments which fit in value_length. When last is set, the last fragment of
+ * the value is left to the caller. Returns the length reported in reported.
+ */
+static cy_rslt_t json_fragment_report( cy_JSON_parser_ctx_t* ctx, char* data, uint32_t length, bool last, uint32_t* reported )
+{
+    cy_rslt_t result;
+    uint32_t  piece;
+
+    *reported = 0;
+    while ( length > ( ( last ) ? JSON_FRAGMENT_MAX_LENGTH : 0 ) )
+    {
+        piece           = json_fragment_length( ctx, data, length );
+        ctx->fragment   = ( ctx->fragmented ) ? CY_JSON_FRAGMENT_MIDDLE : CY_JSON_FRAGMENT_FIRST;
+        ctx->fragmented = true;
+
+        result = json_report_value( ctx, JSON_STRING_TYPE, data, piece );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        data      += piece;
+        length    -= piece;
+        *reported += piece;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Decode, then report part of a string value which does not end it. The callback may ask to skip the rest of the
+ * value and of its container, which are then scanned in the skip states.
+ */
+static cy_rslt_t json_fragment_partial( cy_JSON_parser_ctx_t* ctx, char* data, uint32_t length )
+{
+    cy_rslt_t result    = CY_RSLT_SUCCESS;
+    bool      in_escape = ( ctx->state == JSON_STATE_STRING_ESCAPE );
+    uint32_t  reported;
+
+    if ( ctx->string_escaped && ( ( ctx->options & CY_JSON_OPTION_DECODE_ESCAPES ) != 0 ) )
+    {
+        result = cy_JSON_unescape( data, length, data, length, &length );
+    }
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_fragment_report( ctx, data, length, false, &reported );
+    }
+    if ( result != CY_RSLT_JSON_SKIP )
+    {
+        return result;
+    }
+
+    json_release_value( ctx );
+    ctx->token_in_buffer   = false;
+    ctx->escape_held       = 0;
+    ctx->surrogate_pending = false;
+
+    json_skip_innermost( ctx );
+    ctx->state = ( in_escape ) ? JSON_STATE_SKIP_ESCAPE : JSON_STATE_SKIP_STRING;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* The input buffer ends inside a string value reported in fragments. Report what has arrived, except an escape sequence
+ * which is not complete yet, or a high surrogate which may pair with the next escape: they are held in the token buffer.
+ */
+static cy_rslt_t json_fragment_suspend( cy_JSON_parser_ctx_t* ctx, const char* input, const char* end_of_input )
+{
+    cy_rslt_t   result;
+    const char* start     = ( ctx->token_in_buffer ) ? input : ctx->token_start;
+    uint32_t    available = (uint32_t)( end_of_input - start );
+    uint32_t    held      = ( ( ctx->state != JSON_STATE_STRING ) || ctx->surrogate_pending ) ? ctx->escape_held : 0;
+    char*       data      = (char*)start;
+    uint32_t    length    = available - held;
+
+    if ( !ctx->token_in_buffer )
+    {
+        ctx->token_offset    = ctx->token_buffer_used;
+        ctx->token_in_buffer = true;
+    }
+
+    /* The held escape sequence started in the token buffer: report what is held before it, if anything */
+    if ( held >= available )
+    {
+        result = json_token_buffer_append( ctx, start, available );
+        length = ctx->token_buffer_used - ctx->token_offset - held;
+        if ( ( result != CY_RSLT_SUCCESS ) || ( length == 0 ) )
+        {
+            return result;
+        }
+
+        data   = ctx->token_buffer + ctx->token_offset;
+        result = json_fragment_partial( ctx, data, length );
+        if ( ( result == CY_RSLT_SUCCESS ) && ctx->token_in_buffer )
+        {
+            memmove( data, data + length, held );
+            ctx->token_buffer_used = ctx->token_offset + held;
+        }
+        return result;
+    }
+
+    /* Complete the escape sequence held at the end of the previous input buffer */
+    if ( ctx->token_buffer_used != ctx->token_offset )
+    {
+        result = json_token_buffer_append( ctx, start, length );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        data                   = ctx->token_buffer + ctx->token_offset;
+        length                 = ctx->token_buffer_used - ctx->token_offset;
+        ctx->token_buffer_used = ctx->token_offset;
+    }
+
+    result = json_fragment_partial( ctx, data, length );
+    if ( ( result != CY_RSLT_SUCCESS ) || !ctx->token_in_buffer )
+    {
+        return result;
+    }
+
+    return json_token_buffer_append( ctx, end_of_input - held, held );
+}
+
+/* Open an object or an array. The pending member name, if any, becomes the name of the container */
+static cy_rslt_t json_container_start( cy_JSON_parser_ctx_t* ctx, const char* input )
+{
+    cy_rslt_t               result    = CY_RSLT_SUCCESS;
+    uint8_t                 container = (uint8_t)*input;
+    cy_JSON_parser_level_t* level;
+    cy_JSON_object_t*       parent    = ( ctx->depth ) ? ctx->levels[ ctx->depth - 1 ].member_parent : NULL;
+    uint32_t                complete;
+    uint32_t                below     = 0;
+
+    JSON_STATISTICS_ADD( ctx, tokens[ ( container == OBJECT_START_TOKEN ) ? JSON_OBJECT_TYPE : JSON_ARRAY_TYPE ], 1 );
+
+    if ( ctx->event_handler != NULL )
+    {
+        ctx->json_object.object_string        = ctx->key;
+        ctx->json_object.object_string_length = (uint8_t)ctx->key_length;
+        ctx->json_object.value_type           = ( container == OBJECT_START_TOKEN ) ? JSON_OBJECT_TYPE : JSON_ARRAY_TYPE;
+        ctx->json_object.value                = (char*)input;
+        ctx->json_object.value_length         = 1;
+        ctx->json_object.parent_object        = parent;
+        ctx->json_object.path_hash            = ctx->path_hash;
+
+        result = ctx->event_handler( ctx, CY_JSON_EVENT_CONTAINER_START, &ctx->json_object, ctx->event_argument );
+    }
+    else if ( ctx->paths != NULL )
+    {
+        complete = json_path_match( ctx, &below );
+        if ( complete != 0 )
+        {
+            ctx->json_object.object_string        = ctx->key;
+            ctx->json_object.object_string_length = (uint8_t)ctx->key_length;
+            ctx->json_object.value_type           = ( container == OBJECT_START_TOKEN ) ? JSON_OBJECT_TYPE : JSON_ARRAY_TYPE;
+            ctx->json_object.value                = NULL;
+            ctx->json_object.value_length         = 0;
+            ctx->json_object.parent_object        = parent;
+            ctx->json_object.path_hash            = ctx->path_hash;
+
+            result = json_path_report( ctx, complete );
+        }
+
+        /* Nothing below can match */
+        if ( ( result == CY_RSLT_SUCCESS ) && ( below == 0 ) )
+        {
+            result = CY_JSON_EVENT_RSLT_SKIP;
+        }
+    }
+    else if ( container == ARRAY_START_TOKEN )
+    {
+        /* Arrays are reported when they start, objects are reported through the parent_object of their members */
+        result = json_report_value( ctx, JSON_ARRAY_TYPE, NULL, 0 );
+    }
+
+    /* Skip the contents without parsing them. The container is not opened, so it may be nested deeper than the parser stack */
+    if ( result == CY_JSON_EVENT_RSLT_SKIP )
+    {
+        json_release_value( ctx );
+        ctx->skip_depth = 1;
+        ctx->state      = JSON_STATE_SKIP;
+        return CY_RSLT_SUCCESS;
+    }
+
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    if ( ctx->depth >= ctx->max_depth )
+    {
+        return CY_RSLT_JSON_DEPTH_EXCEEDED;
+    }
+
+    level = &ctx->levels[ ctx->depth ];
+    memset( &level->record, 0x0, sizeof( level->record ) );
+
+    level->record.object_string        = ctx->key;
+    level->record.object_string_length = (uint8_t)ctx->key_length;
+    level->record.value_type           = ( container == OBJECT_START_TOKEN ) ? JSON_OBJECT_TYPE : JSON_ARRAY_TYPE;
+    level->record.parent_object        = parent;
+    level->record.path_hash            = ctx->path_hash;
+    level->name_length                 = ctx->key_length;
+    level->container                   = container;
+    level->paths                       = below;
+    level->count                       = 0;
+
+    /* Members of an unnamed container (the document root or an array element) are reported against the enclosing named container */
+    level->member_parent               = ( ctx->key != NULL ) ? &level->record : parent;
+
+    /* The name of the container stays in the token buffer until the container ends */
+    level->mark     = ctx->stack_used;
+    ctx->stack_used = ctx->token_buffer_used;
+
+    ctx->key        = NULL;
+    ctx->key_length = 0;
+    ctx->depth++;
+
+    if ( ( ctx->statistics != NULL ) && ( ctx->depth > ctx->statistics->max_depth ) )
+    {
+        ctx->statistics->max_depth = ctx->depth;
+    }
+
+    ctx->state = ( container == OBJECT_START_TOKEN ) ? JSON_STATE_KEY_OR_END : JSON_STATE_VALUE_OR_END;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Close the innermost container */
+static cy_rslt_t json_container_end( cy_JSON_parser_ctx_t* ctx, uint8_t container, const char* input )
+{
+    cy_rslt_t               result;
+    cy_JSON_parser_level_t* level = &ctx->levels[ ctx->depth - 1 ];
+
+    if ( level->container != container )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    if ( ctx->event_handler != NULL )
+    {
+        ctx->json_object.object_string        = level->record.object_string;
+        ctx->json_object.object_string_length = level->record.object_string_length;
+        ctx->json_object.value_type           = level->record.value_type;
+        ctx->json_object.value                = (char*)input;
+        ctx->json_object.value_length         = 1;
+        ctx->json_object.parent_object        = level->record.parent_object;
+        ctx->json_object.path_hash            = level->record.path_hash;
+
+        result = ctx->event_handler( ctx, CY_JSON_EVENT_CONTAINER_END, &ctx->json_object, ctx->event_argument );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+    }
+
+    ctx->stack_used        = level->mark;
+    ctx->token_buffer_used = level->mark;
+    ctx->depth--;
+
+    /* Back at the top level, the JSON document is complete */
+    if ( ctx->depth == 0 )
+    {
+        return json_record_complete( ctx );
+    }
+    ctx->state = JSON_STATE_COMMA_OR_END;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Start parsing a value */
+static cy_rslt_t json_value_start( cy_JSON_parser_ctx_t* ctx, const char* input )
+{
+    /* Member or element of the innermost container */
+    ctx->levels[ ctx->depth - 1 ].count++;
+    if ( ( ctx->options & CY_JSON_OPTION_PATH_HASH ) != 0 )
+    {
+        json_path_hash_start( ctx );
+    }
+
+    switch ( *input )
+    {
+        case STRING_TOKEN:
+            ctx->token_start   = (char*)( input + 1 );
+            ctx->string_is_key  = false;
+            ctx->string_escaped = false;
+            ctx->state         = JSON_STATE_STRING;
+            break;
+
+        case OBJECT_START_TOKEN:
+        case ARRAY_START_TOKEN:
+            return json_container_start( ctx, input );
+
+        case TRUE_TOKEN:
+            ctx->literal   = json_true_literal;
+            ctx->sub_state = 1;
+            ctx->state     = JSON_STATE_LITERAL;
+            break;
+
+        case FALSE_TOKEN:
+            ctx->literal   = json_false_literal;
+            ctx->sub_state = 1;
+            ctx->state     = JSON_STATE_LITERAL;
+            break;
+
+        case NULL_TOKEN:
+            ctx->literal   = json_null_literal;
+            ctx->sub_state = 1;
+            ctx->state     = JSON_STATE_LITERAL;
+            break;
+
+        default:
+            if ( ( *input != '-' ) && !JSON_IS_DIGIT( *input ) )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            ctx->token_start = (char*)input;
+            ctx->sub_state   = ( *input == '-' ) ? JSON_NUMBER_MINUS : ( ( *input == '0' ) ? JSON_NUMBER_ZERO : JSON_NUMBER_INTEGER );
+            ctx->state       = JSON_STATE_NUMBER;
+
+            memset( &ctx->number, 0x0, sizeof( ctx->number ) );
+            ctx->number.negative = ( *input == '-' );
+            if ( ctx->sub_state == JSON_NUMBER_INTEGER )
+            {
+                json_number_digit( &ctx->number, *input, false );
+            }
+            break;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Handle a structural character or the first character of a value */
+static cy_rslt_t json_structural( cy_JSON_parser_ctx_t* ctx, const char* input )
+{
+    uint8_t container = ( ctx->depth ) ? ctx->levels[ ctx->depth - 1 ].container : 0;
+
+    switch ( ctx->state )
+    {
+        case JSON_STATE_START:
+            if ( ( *input != OBJECT_START_TOKEN ) && ( *input != ARRAY_START_TOKEN ) )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            if ( ( ctx->options & CY_JSON_OPTION_PATH_HASH ) != 0 )
+            {
+                json_path_hash_start( ctx );
+            }
+            return json_container_start( ctx, input );
+
+        case JSON_STATE_KEY_OR_END:
+            if ( *input == OBJECT_END_TOKEN )
+            {
+                return json_container_end( ctx, OBJECT_START_TOKEN, input );
+            }
+            /* Fall through - parse the member name */
+        case JSON_STATE_KEY:
+            if ( *input != STRING_TOKEN )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            ctx->token_start   = (char*)( input + 1 );
+            ctx->string_is_key  = true;
+            ctx->string_escaped = false;
+            ctx->state         = JSON_STATE_STRING;
+            return CY_RSLT_SUCCESS;
+
+        case JSON_STATE_COLON:
+            if ( *input != START_OF_VALUE )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            ctx->state = JSON_STATE_VALUE;
+            return CY_RSLT_SUCCESS;
+
+        case JSON_STATE_VALUE_OR_END:
+            if ( *input == ARRAY_END_TOKEN )
+            {
+                return json_container_end( ctx, ARRAY_START_TOKEN, input );
+            }
+            /* Fall through - parse the first array value */
+        case JSON_STATE_VALUE:
+            return json_value_start( ctx, input );
+
+        case JSON_STATE_COMMA_OR_END:
+            if ( *input == COMMA_SEPARATOR )
+            {
+                ctx->state = ( container == OBJECT_START_TOKEN ) ? JSON_STATE_KEY : JSON_STATE_VALUE;
+                return CY_RSLT_SUCCESS;
+            }
+            if ( *input == OBJECT_END_TOKEN )
+            {
+                return json_container_end( ctx, OBJECT_START_TOKEN, input );
+            }
+            if ( *input == ARRAY_END_TOKEN )
+            {
+                return json_container_end( ctx, ARRAY_START_TOKEN, input );
+            }
+            return CY_RSLT_JSON_GENERIC_ERROR;
+
+        default:
+            return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+}
+
+/* The input buffer ends in the middle of a JSON document. Move everything that is still needed
+ * (container names, the pending member name and the partial token) into the token buffer, so that
+ * parsing can resume with the next input buffer.
+ */
+static cy_rslt_t json_parser_suspend( cy_JSON_parser_ctx_t* ctx, const char* input, const char* end_of_input )
+{
+    cy_rslt_t result;
+    uint32_t  i;
+    char*     name;
+
+    /* Names already in the token buffer always belong to the outermost containers. Skip past them */
+    for ( i = ctx->depth; i > 0; i-- )
+    {
+        if ( ( ctx->levels[ i - 1 ].record.object_string != NULL ) && json_is_in_token_buffer( ctx, ctx->levels[ i - 1 ].record.object_string ) )
+        {
+            break;
+        }
+    }
+
+    for ( ; i < ctx->depth; i++ )
+    {
+        cy_JSON_parser_level_t* level = &ctx->levels[ i ];
 
-    if ( ( *( current_input_token ) == OBJECT_START_TOKEN ) || ( *( current_input_token ) == ARRAY_START_TOKEN ) )
+        level->mark = ctx->stack_used;
+
+        if ( level->record.object_string != NULL )
+        {
+            name   = ctx->token_buffer + ctx->token_buffer_used;
+            result = json_token_buffer_append( ctx, level->record.object_string, level->name_length );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            level->record.object_string = name;
+            ctx->stack_used             = ctx->token_buffer_used;
+        }
+    }
+
+    if ( ( ctx->key != NULL ) && !json_is_in_token_buffer( ctx, ctx->key ) )
     {
-        /* Parse through entire input */
-        while ( current_input_token < end_of_input )
+        name   = ctx->token_buffer + ctx->token_buffer_used;
+        result = json_token_buffer_append( ctx, ctx->key, ctx->key_length );
+        if ( result != CY_RSLT_SUCCESS )
         {
-            switch ( *current_input_token )
+            return result;
+        }
+        ctx->key = name;
+    }
+
+    switch ( ctx->state )
+    {
+        case JSON_STATE_STRING:
+        case JSON_STATE_STRING_ESCAPE:
+        case JSON_STATE_STRING_UNICODE:
+            if ( ( ( ctx->options & CY_JSON_OPTION_STRING_FRAGMENTS ) != 0 ) && !ctx->string_is_key )
+            {
+                return json_fragment_suspend( ctx, input, end_of_input );
+            }
+            /* Fall through - keep the partial string in the token buffer */
+        case JSON_STATE_NUMBER:
+            if ( ctx->token_in_buffer )
             {
-                /* This is a start of object token */
-                case OBJECT_START_TOKEN:
+                return json_token_buffer_append( ctx, input, (uint32_t)( end_of_input - input ) );
+            }
+            ctx->token_offset    = ctx->token_buffer_used;
+            ctx->token_in_buffer = true;
+            return json_token_buffer_append( ctx, ctx->token_start, (uint32_t)( end_of_input - ctx->token_start ) );
 
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
+        default:
+            return CY_RSLT_SUCCESS;
+    }
+}
 
-                    /* Skip in case we're parsing a string value */
-                    if ( ( string_start != NULL ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
+/* Account for a call parsing an input buffer, which consumed bytes of it from the clock count start */
+static void json_statistics_parse( cy_JSON_parser_ctx_t* ctx, uint32_t consumed, uint32_t start )
+{
+    cy_JSON_statistics_t* statistics = ctx->statistics;
+    uint32_t              time;
 
-                    /* In case the json is split across packets, record the most recent object market
-                     * and copy from this point forward
-                     */
-                    most_recent_object_marker = current_input_token;
+    statistics->parse_calls++;
+    statistics->bytes_scanned += consumed;
 
-                    /* Keep track of the number of objects open */
-                    object_counter++;
+    if ( ctx->clock != NULL )
+    {
+        time                        = ctx->clock( ctx->clock_argument ) - start;
+        statistics->parse_time     += time;
+        statistics->max_parse_time  = ( time > statistics->max_parse_time ) ? time : statistics->max_parse_time;
+    }
+}
 
-                    type = JSON_OBJECT_TYPE;
-                    /* If we have already captured some string value, then this string must represent the name of this object */
-                    if ( string_end )
-                    {
-                        /* prepare JSON object. The object string was already piced up by the start of value token */
-                        json_object.value_type = type;
-                        json_object.value = NULL;
-                        json_object.value_length = 0;
-
-                        /* Reset the string and value pointers */
-                        string_start = NULL;
-                        string_end = NULL;
-                        value_start = NULL;
-                        value_end = NULL;
-                    }
+/* Stop parsing on an error. The JSON document being parsed, if any, is dropped */
+static void json_parser_abort( cy_JSON_parser_ctx_t* ctx, uint32_t consumed, uint32_t start )
+{
+    if ( ctx->statistics != NULL )
+    {
+        ctx->statistics->dropped_documents += ( ( ctx->state != JSON_STATE_START ) || ( ctx->depth != 0 ) ) ? 1 : 0;
+        json_statistics_parse( ctx, consumed, start );
+    }
 
-                    if ( ( ( json_object.value_type == JSON_ARRAY_TYPE ) || ( json_object.value_type == JSON_OBJECT_TYPE ) ) && ( parent_counter < MAX_PARENTS ) )
-                    {
-                        parent_json_object[ parent_counter ] = json_object;
-                        json_object.parent_object = &parent_json_object[ parent_counter ];
-                        parent_counter++;
-                    }
-                    else if ( *previous_token == COMMA_SEPARATOR )
-                    {
-                        json_object.parent_object = &parent_json_object[ parent_counter ];
-                        parent_counter++;
-                    }
-                    previous_token = current_input_token;
+    json_parser_reset_state( ctx );
+}
 
-                    break;
+static void json_parser_reset_state( cy_JSON_parser_ctx_t* ctx )
+{
+    ctx->state             = JSON_STATE_START;
+    ctx->sub_state         = 0;
+    ctx->depth             = 0;
+    ctx->key               = NULL;
+    ctx->key_length        = 0;
+    ctx->token_start       = NULL;
+    ctx->token_in_buffer   = false;
+    ctx->token_offset      = 0;
+    ctx->token_buffer_used = 0;
+    ctx->stack_used        = 0;
+    ctx->skip_depth        = 0;
+    ctx->pause             = false;
+    ctx->fragment          = CY_JSON_FRAGMENT_NONE;
+    ctx->fragmented        = false;
+    ctx->surrogate_pending = false;
+    ctx->escape_held       = 0;
+}
 
-                /* This is an end of object token */
-                case OBJECT_END_TOKEN:
 
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
+cy_rslt_t cy_JSON_parser_ctx_init( cy_JSON_parser_ctx_t* ctx )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                    /* Skip in case we're parsing a string value */
-                    if ( ( string_start != NULL ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
+    memset( ctx, 0x0, sizeof( *ctx ) );
 
-                    object_counter--;
+    ctx->json_object.value_type = UNKNOWN_JSON_TYPE;
+    ctx->json_object.boolval    = true;
+    ctx->levels                 = ctx->default_levels;
+    ctx->max_depth              = CY_JSON_MAX_DEPTH;
 
-                    if ( *( previous_token ) == COMMA_SEPARATOR )
-                    {
-                        if ( *( current_input_token ) == ( OBJECT_END_TOKEN ) )
-                        {
-                            valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                            object_counter = 0;
-                            array_counter = 0;
-                            return valid_json_string;
-                        }
-                    }
-                    /* Extract final value in object list. If we have already marked the beginning of a value, than this must be final value in object list */
-                    if ( value_start )
-                    {
-                        value_end = current_input_token;
-                        /* If previous was a string token, then this must be a string value */
-                        if ( *previous_token == STRING_TOKEN )
-                        {
-                            type = JSON_STRING_TYPE;
+    json_parser_reset_state( ctx );
 
-                            /* Move value token to point prior to string token and to last character of string value*/
-                            value_end = previous_token - 1;
-                            value_start = string_start + 1;
-                        }
-                        else if ( *previous_token == TRUE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
+    return CY_RSLT_SUCCESS;
+}
 
-                            value_end = previous_token + sizeof( "true" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == FALSE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
 
-                            value_end = previous_token + sizeof( "false" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == NULL_TOKEN )
-                        {
-                            type = JSON_NULL_TYPE;
-                            value_end = previous_token + sizeof( "null" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else
-                        {
-                            char*   start = NULL;
-                            char*   end = NULL;
-                            uint8_t len = 0;
-                            /* This must be a number value if not string. Arrays would have been picked up already by the end of array token */
-                            type = JSON_NUMBER_TYPE;
-
-                            end = value_end;
-
-                            start = previous_token;
-                            start++;
-                            end--;
-                            while ( *end == ' ' )
-                            {
-                                end--;
-                            }
-                            while ( *start == ' ' )
-                            {
-                                start++;
-                            }
+cy_rslt_t cy_JSON_parser_ctx_reset( cy_JSON_parser_ctx_t* ctx )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                            len = end - start + 1;
+    /* Drop any partially parsed document but keep the registered callback and token buffer */
+    json_parser_reset_state( ctx );
+    ctx->record_count = 0;
 
-                            if ( validate_array_value( start, end, len ) != CY_RSLT_SUCCESS )
-                            {
-                                valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                                object_counter = 0;
-                                array_counter = 0;
-                                return valid_json_string;
-                            }
+    return CY_RSLT_SUCCESS;
+}
 
-                            /* Keep moving the value end token back till you encounter a digit */
-                            while ( ( *value_end < '0' ) || ( *value_end > '9' ) )
-                            {
-                                value_end--;
-                            }
 
-                            /* Initialise the value_start token with value_end */
-                            value_start = value_end;
+cy_rslt_t cy_JSON_parser_ctx_set_token_buffer( cy_JSON_parser_ctx_t* ctx, char* buffer, uint32_t size )
+{
+    if ( ( ctx == NULL ) || ( ( buffer == NULL ) && ( size != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                            /* Move value_start token until we encounter a non-digit value */
-                            while ( ( ( *value_start >= '0' ) && ( *value_start <= '9' ) ) || ( *value_start == '.' ) || ( *value_start == '-' ) )
-                            {
-                                value_start--;
-                            }
+    ctx->token_buffer      = buffer;
+    ctx->token_buffer_size = size;
 
-                            /*Point to first number */
-                            value_start++;
-                        }
+    json_parser_reset_state( ctx );
 
-                        /* Prepare JSON object */
-                        json_object.value_type = type;
-                        json_object.value = value_start;
-                        json_object.value_length = value_end - value_start + 1;
+    return CY_RSLT_SUCCESS;
+}
 
-                        if ( internal_json_callback != NULL )
-                        {
-                            str_convertor( &json_object );
-                            internal_json_callback( &json_object, internal_json_argument );
-                        }
 
-                        /* Reset the value pointers */
-                        value_start = NULL;
-                        value_end = NULL;
-                        string_start = NULL;
-                        string_end = NULL;
-                        type = UNKNOWN_JSON_TYPE;
-                    }
-                    if ( parent_counter )
-                    {
-                        parent_counter--;
+cy_rslt_t cy_JSON_parser_ctx_set_stack( cy_JSON_parser_ctx_t* ctx, cy_JSON_parser_level_t* levels, uint32_t max_depth )
+{
+    if ( ( ctx == NULL ) || ( ( levels != NULL ) && ( max_depth == 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                        if ( parent_counter )
-                        {
-                            json_object.parent_object = &parent_json_object[ parent_counter - 1 ];
-                        }
-                        else
-                        {
-                            json_object.parent_object = &parent_json_object[ parent_counter ];
-                        }
-                    }
-                    else
-                    {
-                        json_object.parent_object = NULL;
-                    }
-                    previous_token = current_input_token;
+    ctx->levels    = ( levels != NULL ) ? levels : ctx->default_levels;
+    ctx->max_depth = ( levels != NULL ) ? max_depth : CY_JSON_MAX_DEPTH;
 
-                    break;
+    json_parser_reset_state( ctx );
 
-                case STRING_TOKEN:
+    return CY_RSLT_SUCCESS;
+}
 
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
-                    /* This indicates this must be closing token for object name */
-                    if ( *previous_token == STRING_TOKEN )
-                    {
-                        /* Get the last character of the string name */
-                        string_end = current_input_token;
-                    }
-                    else
-                    {
-                        /* Find start and end of of object name */
-                        string_start = current_input_token;
-                        string_end = NULL;
-                    }
-                    previous_token = current_input_token;
 
-                    break;
+cy_rslt_t cy_JSON_parser_ctx_set_options( cy_JSON_parser_ctx_t* ctx, uint32_t options )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                case TRUE_TOKEN:
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
-                    if ( *previous_token == OBJECT_START_TOKEN )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
+    ctx->options = options;
 
-                        return valid_json_string;
-                    }
-                    if ( ( *previous_token == START_OF_VALUE ) && ( string_end ) )
+    return CY_RSLT_SUCCESS;
+}
+
+
+/* Register callbacks parser will use to populate fields*/
+cy_rslt_t cy_JSON_parser_ctx_register_callback( cy_JSON_parser_ctx_t* ctx, cy_JSON_callback_t json_callback, void *arg )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    ctx->callback = json_callback;
+    ctx->argument = arg;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_parser_ctx_register_record_callback( cy_JSON_parser_ctx_t* ctx, cy_JSON_record_callback_t record_callback, void* arg )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    ctx->record_callback = record_callback;
+    ctx->record_argument = arg;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_parser_ctx_set_statistics( cy_JSON_parser_ctx_t* ctx, cy_JSON_statistics_t* statistics, cy_JSON_clock_t clock, void* arg )
+{
+    if ( ctx == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( statistics != NULL )
+    {
+        memset( statistics, 0x0, sizeof( *statistics ) );
+    }
+
+    ctx->statistics     = statistics;
+    ctx->clock          = clock;
+    ctx->clock_argument = arg;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_parser_ctx_reset_statistics( cy_JSON_parser_ctx_t* ctx )
+{
+    if ( ( ctx == NULL ) || ( ctx->statistics == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( ctx->statistics, 0x0, sizeof( *ctx->statistics ) );
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+void cy_json_parser_convert_number( cy_JSON_parser_ctx_t* ctx, cy_JSON_object_t* json_object )
+{
+    json_number_convert( ctx, json_object );
+#ifdef CY_JSON_FIXED_POINT
+    /* The modules calling this function decode numbers into doubles and floats */
+    json_number_floating( &ctx->number, json_object );
+#endif
+}
+
+
+const char* cy_json_parser_scan_number( const char* position, const char* end, cy_JSON_number_t* number, cy_JSON_object_t* json_object )
+{
+    const char* start      = position;
+    bool        is_integer = true;
+
+    memset( number, 0x0, sizeof( *number ) );
+
+    if ( ( position < end ) && ( *position == '-' ) )
+    {
+        number->negative = true;
+        position++;
+    }
+    if ( position == end )
+    {
+        return end;
+    }
+
+    /* Integer part, without leading zeros */
+    if ( *position == '0' )
+    {
+        position++;
+    }
+    else if ( JSON_IS_DIGIT( *position ) )
+    {
+        position = json_number_digits( number, position, end, false );
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if ( ( position < end ) && ( *position == '.' ) )
+    {
+        position++;
+        if ( ( position < end ) && !JSON_IS_DIGIT( *position ) )
+        {
+            return NULL;
+        }
+        position   = json_number_digits( number, position, end, true );
+        is_integer = false;
+    }
+
+    if ( ( position < end ) && ( ( *position == 'e' ) || ( *position == 'E' ) ) )
+    {
+        position++;
+        if ( ( position < end ) && ( ( *position == '+' ) || ( *position == '-' ) ) )
+        {
+            number->exponent_negative = ( *position == '-' );
+            position++;
+        }
+        if ( ( position < end ) && !JSON_IS_DIGIT( *position ) )
+        {
+            return NULL;
+        }
+        /* Any exponent beyond the range of a double saturates */
+        for ( ; ( position < end ) && JSON_IS_DIGIT( *position ); position++ )
+        {
+            if ( number->explicit_exponent < JSON_NUMBER_MAX_EXPONENT )
+            {
+                number->explicit_exponent = ( number->explicit_exponent * 10 ) + (uint32_t)( *position - '0' );
+            }
+        }
+        is_integer = false;
+    }
+
+    if ( position == end )
+    {
+        return end;
+    }
+
+    json_object->value        = (char*)start;
+    json_object->value_length = (uint16_t)( ( ( position - start ) > 0xFFFF ) ? 0xFFFF : ( position - start ) );
+    json_number_value( number, is_integer, json_object );
+
+    return position;
+}
+
+
+#ifdef CY_JSON_FIXED_POINT
+void cy_json_parser_number_floating( const cy_JSON_number_t* number, cy_JSON_object_t* json_object )
+{
+    json_number_floating( number, json_object );
+}
+#endif
+
+
+void cy_json_parser_set_event_handler( cy_JSON_parser_ctx_t* ctx, cy_JSON_event_handler_t handler, void* arg )
+{
+    ctx->event_handler  = handler;
+    ctx->event_argument = arg;
+}
+
+
+void cy_json_parser_pause( cy_JSON_parser_ctx_t* ctx )
+{
+    ctx->pause = true;
+}
+
+
+void cy_json_parser_skip_container( cy_JSON_parser_ctx_t* ctx )
+{
+    json_skip_innermost( ctx );
+}
+
+
+cy_rslt_t cy_JSON_path_compile( cy_JSON_path_t* path, const char* pattern, cy_JSON_callback_t callback, void* arg )
+{
+    cy_JSON_path_segment_t* segment;
+    const char*             start;
+
+    if ( ( path == NULL ) || ( pattern == NULL ) || ( *pattern == '\0' ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( path, 0x0, sizeof( *path ) );
+    path->callback = callback;
+    path->argument = arg;
+
+    while ( *pattern != '\0' )
+    {
+        if ( path->segment_count >= CY_JSON_PATH_MAX_SEGMENTS )
+        {
+            return CY_RSLT_JSON_BADARG;
+        }
+        segment = &path->segments[ path->segment_count++ ];
+
+        if ( *pattern == ARRAY_START_TOKEN )
+        {
+            /* "[n]" or "[*]" */
+            pattern++;
+            if ( ( pattern[ 0 ] == '*' ) && ( pattern[ 1 ] == ARRAY_END_TOKEN ) )
+            {
+                segment->index = CY_JSON_PATH_ANY;
+                pattern++;
+            }
+            else
+            {
+                if ( !JSON_IS_DIGIT( *pattern ) )
+                {
+                    return CY_RSLT_JSON_BADARG;
+                }
+                while ( JSON_IS_DIGIT( *pattern ) )
+                {
+                    if ( segment->index > ( ( CY_JSON_PATH_ANY - 10 ) / 10 ) )
                     {
-                        previous_token = current_input_token;
-                        current_input_token = current_input_token + sizeof( "true" ) - 2;
+                        return CY_RSLT_JSON_BADARG;
                     }
+                    segment->index = ( segment->index * 10 ) + (uint32_t)( *pattern - '0' );
+                    pattern++;
+                }
+            }
+            if ( *pattern != ARRAY_END_TOKEN )
+            {
+                return CY_RSLT_JSON_BADARG;
+            }
+            pattern++;
+            if ( ( *pattern != '\0' ) && ( *pattern != '.' ) && ( *pattern != ARRAY_START_TOKEN ) )
+            {
+                return CY_RSLT_JSON_BADARG;
+            }
+        }
+        else
+        {
+            /* Member name, up to the next '.' or '[' */
+            start = pattern;
+            while ( ( *pattern != '\0' ) && ( *pattern != '.' ) && ( *pattern != ARRAY_START_TOKEN ) && ( *pattern != ARRAY_END_TOKEN ) )
+            {
+                pattern++;
+            }
+            if ( ( pattern == start ) || ( *pattern == ARRAY_END_TOKEN ) )
+            {
+                return CY_RSLT_JSON_BADARG;
+            }
+            segment->key        = start;
+            segment->key_length = (uint32_t)( pattern - start );
+            segment->index      = ( ( segment->key_length == 1 ) && ( *start == '*' ) ) ? CY_JSON_PATH_ANY : 0;
+        }
 
-                    break;
+        /* A '.' must be followed by a member name */
+        if ( *pattern == '.' )
+        {
+            pattern++;
+            if ( ( *pattern == '\0' ) || ( *pattern == '.' ) || ( *pattern == ARRAY_START_TOKEN ) )
+            {
+                return CY_RSLT_JSON_BADARG;
+            }
+        }
+    }
 
-                case FALSE_TOKEN:
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
-                    if ( *previous_token == OBJECT_START_TOKEN )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
-                        array_counter = 0;
-                        return valid_json_string;
-                    }
-                    if ( ( *previous_token == START_OF_VALUE ) && ( string_end ) )
-                    {
-                        /* Skip ahead as this must be boolean false */
-                        previous_token = current_input_token;
-                        current_input_token = current_input_token + sizeof( "false" ) - 2;
-                    }
-                    break;
+    return CY_RSLT_SUCCESS;
+}
 
-                case NULL_TOKEN:
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
-                    if ( ( *previous_token == START_OF_VALUE ) && ( string_end ) )
-                    {
-                        previous_token = current_input_token;
-                        current_input_token = current_input_token + sizeof( "null" ) - 2;
-                    }
-                    break;
 
-                case ARRAY_START_TOKEN:
+uint32_t cy_JSON_path_hash( const char* path, uint32_t length )
+{
+    if ( path == NULL )
+    {
+        return CY_JSON_PATH_HASH_INIT;
+    }
 
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
+    return json_path_hash_update( CY_JSON_PATH_HASH_INIT, path, length );
+}
 
-                    /* Skip in case we're parsing a string value */
-                    if ( ( string_start != NULL ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
-                    else if (string_start == NULL)
-                    {
-                        json_object.object_string = NULL;
-                        json_object.object_string_length = 0;
-                    }
 
-                    array_counter++;
-                    /*This means the last object name must have an array value type*/
-                    type = JSON_ARRAY_TYPE;
+cy_rslt_t cy_JSON_parser_ctx_subscribe( cy_JSON_parser_ctx_t* ctx, const cy_JSON_path_t* paths, uint32_t count )
+{
+    if ( ( ctx == NULL ) || ( count > CY_JSON_MAX_PATHS ) || ( ( paths == NULL ) && ( count != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                    json_object.value_type = type;
-                    json_object.value = NULL;
-                    json_object.value_length = 0;
+    ctx->paths      = ( count != 0 ) ? paths : NULL;
+    ctx->path_count = count;
 
-                    if ( internal_json_callback != NULL )
-                    {
-                        str_convertor( &json_object );
-                        internal_json_callback( &json_object, internal_json_argument );
-                    }
+    json_parser_reset_state( ctx );
 
-                    /* Reset object string start/end tokens */
-                    string_start = NULL;
-                    string_end = NULL;
+    return CY_RSLT_SUCCESS;
+}
 
-                    previous_token = current_input_token;
 
-                    break;
+/* Get current callback */
+cy_JSON_callback_t cy_JSON_parser_ctx_get_callback( cy_JSON_parser_ctx_t* ctx )
+{
+    if ( ctx == NULL )
+    {
+        return NULL;
+    }
 
-                case ARRAY_END_TOKEN:
+    return ctx->callback;
+}
 
-                    if ( escape_token )
-                    {
-                        escape_token = false;
-                        break;
-                    }
 
-                    /* Skip in case we're parsing a string value */
-                    if ( ( string_start != NULL ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
+cy_rslt_t cy_JSON_parser_register_callback( cy_JSON_callback_t json_callback, void *arg )
+{
+    return cy_JSON_parser_ctx_register_callback( &default_json_parser_ctx, json_callback, arg );
+}
 
-                    array_counter--;
 
+cy_JSON_callback_t cy_JSON_parser_get_callback( void )
+{
+    return cy_JSON_parser_ctx_get_callback( &default_json_parser_ctx );
+}
 
-                    if ( *( previous_token ) == START_OF_VALUE )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
-                        return valid_json_string;
-                    }
 
-                    if ( *( current_input_token - space - 1 ) == COMMA_SEPARATOR )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
-                        array_counter = 0;
-                        return valid_json_string;
-                    }
+cy_rslt_t cy_JSON_parser( const char* json_input, uint32_t input_length )
+{
+    return cy_JSON_parser_ctx_parse( &default_json_parser_ctx, json_input, input_length );
+}
 
-                    /* Ignore comma separators in values */
-                    if ( ( string_start ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
-                    /* If this comma is within an array, it must be delimiting values, so extract the comma delimited value */
-                    else if ( type == JSON_ARRAY_TYPE )
-                    {
-                        /* If the token prior to the comma was a string token, then the delimited value must be a string */
-                        if ( *previous_token == STRING_TOKEN )
-                        {
-                            type = JSON_STRING_TYPE;
 
-                            /* Move token to point prior to string token and to last character of string value*/
-                            value_end = previous_token - 1;
-                            value_start = string_start + 1;
-                        }
-                        else if ( *previous_token == TRUE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
+cy_rslt_t cy_JSON_parser_ctx_parse( cy_JSON_parser_ctx_t* ctx, const char* json_input, uint32_t input_length )
+{
+    uint32_t consumed;
 
-                            value_end = previous_token + sizeof( "true" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == FALSE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
+    /* Escape sequences are decoded in the input, which must then be passed to cy_JSON_parser_ctx_parse_in_place() */
+    if ( ( ctx != NULL ) && ( ( ctx->options & CY_JSON_OPTION_DECODE_ESCAPES ) != 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                            value_end = previous_token + sizeof( "false" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == NULL_TOKEN )
-                        {
-                            type = JSON_NULL_TYPE;
-                            value_end = previous_token + sizeof( "null" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else
-                        {
-                            char*   start = NULL;
-                            char*   end = NULL;
-                            uint8_t len = 0;
-                            /* Delimited values must be a NUMBER if they are not a string */
-                            type = JSON_NUMBER_TYPE;
+    return cy_json_parser_resume( ctx, json_input, input_length, &consumed );
+}
 
-                            /* Set value_end to point to current location */
-                            value_end = current_input_token;
 
-                            /* This must be a number value if not string. Arrays would have been picked up already by the end of array token */
-                            type = JSON_NUMBER_TYPE;
+cy_rslt_t cy_JSON_parser_ctx_parse_in_place( cy_JSON_parser_ctx_t* ctx, char* json_input, uint32_t input_length )
+{
+    uint32_t consumed;
 
-                            end = value_end;
+    return cy_json_parser_resume( ctx, json_input, input_length, &consumed );
+}
 
-                            start = previous_token;
-                            start++;
-                            end--;
-                            while ( *end == ' ' )
-                            {
-                                end--;
-                            }
-                            while ( *start == ' ' )
-                            {
-                                start++;
-                            }
 
-                            len = end - start + 1;
+cy_rslt_t cy_JSON_parser_segments( const cy_JSON_segment_t* segments, uint32_t segment_count )
+{
+    return cy_JSON_parser_ctx_parse_segments( &default_json_parser_ctx, segments, segment_count );
+}
 
-                            if ( validate_array_value( start, end, len ) != CY_RSLT_SUCCESS )
-                            {
-                                valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                                object_counter = 0;
-                                array_counter = 0;
-                                return valid_json_string;
-                            }
 
-                            /* Point to last number. Keep moving the value end token back till you encounter a digit */
-                            while ( ( *value_end < '0' ) || ( *value_end > '9' ) )
-                            {
-                                value_end--;
-                            }
+cy_rslt_t cy_JSON_parser_ctx_parse_segments( cy_JSON_parser_ctx_t* ctx, const cy_JSON_segment_t* segments, uint32_t segment_count )
+{
+    cy_rslt_t result;
+    uint32_t  i;
 
-                            /* Initialise the value_start pointer to point to last digit */
-                            value_start = value_end;
+    if ( ( ctx == NULL ) || ( ( segments == NULL ) && ( segment_count != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                            /* Increment value_start until you reach first number */
-                            while ( ( ( *value_start >= '0' ) && ( *value_start <= '9' ) ) || ( *value_start == '.' ) || ( *value_start == '-' ) )
-                            {
-                                value_start--;
-                            }
+    result = ( ( ctx->state == JSON_STATE_START ) && ( ctx->depth == 0 ) ) ? CY_RSLT_SUCCESS : CY_RSLT_JSON_INCOMPLETE;
 
-                            /*Point to first number */
-                            value_start++;
-                        }
+    for ( i = 0; i < segment_count; i++ )
+    {
+        if ( segments[ i ].length == 0 )
+        {
+            continue;
+        }
 
-                        /* prepare JSON object */
-                        json_object.object_string = NULL;
-                        json_object.object_string_length = 0;
-                        json_object.value_type = type;
-                        json_object.value = value_start;
-                        json_object.value_length = value_end - value_start + 1;
+        result = cy_JSON_parser_ctx_parse( ctx, segments[ i ].data, segments[ i ].length );
+        if ( ( result != CY_RSLT_SUCCESS ) && ( result != CY_RSLT_JSON_INCOMPLETE ) )
+        {
+            break;
+        }
+    }
 
-                        if ( internal_json_callback != NULL )
-                        {
-                            str_convertor( &json_object );
-                            internal_json_callback( &json_object, internal_json_argument );
-                        }
+    return result;
+}
 
-                        string_start = NULL;
-                        string_end = NULL;
-                        value_start = NULL;
-                        value_end = NULL;
-                        type = JSON_ARRAY_TYPE;
-                    }
 
-                    type = UNKNOWN_JSON_TYPE;
-                    previous_token = current_input_token;
+cy_rslt_t cy_json_parser_resume( cy_JSON_parser_ctx_t* ctx, const char* json_input, uint32_t input_length, uint32_t* consumed )
+{
+    cy_rslt_t   result = CY_RSLT_SUCCESS;
+    const char* current_input_token;
+    const char* end_of_input;
+    char*       token;
+    uint32_t    token_length;
+    uint32_t    reported;
+    uint32_t    start = 0;
+
+    if ( ( ctx == NULL ) || ( ( json_input == NULL ) && ( input_length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
 
-                    break;
+    if ( ( ctx->statistics != NULL ) && ( ctx->clock != NULL ) )
+    {
+        start = ctx->clock( ctx->clock_argument );
+    }
 
-                case START_OF_VALUE:
+    current_input_token = json_input;
+    end_of_input        = json_input + input_length;
 
-                    if ( escape_token )
+    while ( current_input_token < end_of_input )
+    {
+        switch ( ctx->state )
+        {
+            case JSON_STATE_STRING:
+                if ( ctx->surrogate_pending && ( *current_input_token != ESCAPE_TOKEN ) )
+                {
+                    /* The high surrogate is not followed by an escape sequence which could pair with it */
+                    ctx->surrogate_pending = false;
+                    ctx->escape_held       = 0;
+                }
+
+                /* The escape sequence held at the end of the previous input buffer is complete. Report it with
+                 * the rest of the string value received so far, which continues in place in this input buffer.
+                 */
+                if ( ctx->token_in_buffer && !ctx->surrogate_pending && !ctx->string_is_key && ( ( ctx->options & CY_JSON_OPTION_STRING_FRAGMENTS ) != 0 ) )
+                {
+                    result = json_token_buffer_append( ctx, json_input, (uint32_t)( current_input_token - json_input ) );
+                    if ( result != CY_RSLT_SUCCESS )
                     {
-                        escape_token = false;
                         break;
                     }
+                    token_length           = ctx->token_buffer_used - ctx->token_offset;
+                    ctx->token_buffer_used = ctx->token_offset;
+                    ctx->token_in_buffer   = false;
+                    ctx->token_start       = (char*)current_input_token;
 
-                    if ( ( *( previous_token  ) == OBJECT_START_TOKEN ) || ( *( previous_token  ) == ARRAY_START_TOKEN ) )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
-                        array_counter = 0;
-                        return valid_json_string;
-                    }
-                    if ( string_end )
-                    {
-                        /* prepare JSON object */
-                        json_object.object_string = string_start + 1;
-                        json_object.object_string_length = string_end - string_start - 1;
-                        type = UNKNOWN_JSON_TYPE;
-                        previous_token = current_input_token;
-                    }
-                    if ( value_start == NULL )
+                    result = json_fragment_partial( ctx, ctx->token_buffer + ctx->token_offset, token_length );
+                    if ( ( result != CY_RSLT_SUCCESS ) || ( ctx->state != JSON_STATE_STRING ) )
                     {
-                        value_start = current_input_token;
+                        break;
                     }
+                }
 
+                /* Skip over the plain characters of the string */
+                current_input_token = cy_json_scan_string( current_input_token, end_of_input );
+                if ( current_input_token == end_of_input )
+                {
                     break;
-
-                case COMMA_SEPARATOR:
-
-                    if ( escape_token )
+                }
+
+                if ( *current_input_token == ESCAPE_TOKEN )
+                {
+                    /* An escape sequence right after a high surrogate may be its low surrogate: both are held together */
+                    ctx->escape_held    = ( ctx->surrogate_pending ) ? (uint8_t)( ctx->escape_held + 1 ) : 1;
+                    ctx->string_escaped = true;
+                    ctx->state          = JSON_STATE_STRING_ESCAPE;
+                }
+                else if ( *current_input_token == STRING_TOKEN )
+                {
+                    result = json_token_complete( ctx, json_input, current_input_token, &token, &token_length );
+                    if ( result != CY_RSLT_SUCCESS )
                     {
-                        escape_token = false;
                         break;
                     }
 
-                    /* Ignore comma separators in values */
-                    if ( ( string_start ) && ( string_end == NULL ) )
-                    {
-                        break;
-                    }
-                    /* If this comma is within an array, it must be delimiting values, so extract the comma delimited value */
-                    else if ( type == JSON_ARRAY_TYPE )
+                    /* The decoded string is never longer than the escaped one */
+                    if ( ctx->string_escaped && ( ( ctx->options & CY_JSON_OPTION_DECODE_ESCAPES ) != 0 ) )
                     {
-                        /* If the token prior to the comma was a string token, then the delimited value must be a string */
-                        if ( *previous_token == STRING_TOKEN )
-                        {
-                            type = JSON_STRING_TYPE;
-
-                            /* Move token to point prior to string token and to last character of string value*/
-                            value_end = previous_token - 1;
-                            value_start = string_start + 1;
-                        }
-                        else if ( *previous_token == TRUE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
-
-                            value_end = previous_token + sizeof( "true" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == FALSE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
-
-                            value_end = previous_token + sizeof( "false" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == NULL_TOKEN )
-                        {
-                            type = JSON_NULL_TYPE;
-                            value_end = previous_token + sizeof( "null" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else
+                        result = cy_JSON_unescape( token, token_length, token, token_length, &token_length );
+                        if ( result != CY_RSLT_SUCCESS )
                         {
-                            /* Delimited values must be a NUMBER if they are not a string */
-                            type = JSON_NUMBER_TYPE;
-
-                            /* Set value_end to point to current location */
-                            value_end = current_input_token;
-
-                            /* Point to last number. Keep moving the value end token back till you encounter a digit */
-                            while ( ( *value_end < '0' ) || ( *value_end > '9' ) )
-                            {
-                                value_end--;
-                            }
-
-                            /* Initialise the value_start pointer to point to last digit */
-                            value_start = value_end;
-
-                            /* Increment value_start until you reach first number */
-                            while ( ( ( ( *value_start >= '0' ) && ( *value_start <= '9' ) ) || ( *value_start == '.' ) || ( *value_start == '-' ) ) && ( *previous_token != *value_start ) )
-                            {
-                                value_start--;
-                            }
-
-                            /*Point to first number */
-                            value_start++;
+                            break;
                         }
+                    }
 
-                        /* prepare JSON object */
-                        json_object.object_string = NULL;
-                        json_object.object_string_length = 0;
-                        json_object.value_type = type;
-                        json_object.value = value_start;
-                        json_object.value_length = value_end - value_start + 1;
+                    ctx->surrogate_pending = false;
+                    ctx->escape_held       = 0;
 
-                        if ( internal_json_callback != NULL )
-                        {
-                            str_convertor( &json_object );
-                            internal_json_callback( &json_object, internal_json_argument );
-                        }
-                        value_start = NULL;
-                        value_end = NULL;
-                        string_start = NULL;
-                        string_end = NULL;
-                        type = JSON_ARRAY_TYPE;
+                    if ( ctx->string_is_key )
+                    {
+                        JSON_STATISTICS_ADD( ctx, keys, 1 );
+                        ctx->key        = token;
+                        ctx->key_length = (uint16_t)token_length;
+                        ctx->state      = JSON_STATE_COLON;
                     }
-                    else if ( value_start )
+                    else
                     {
-                        value_end = current_input_token;
-
-                        /* Commas are only used to seperate values so this must indicate an end of value, which means last object information is for us */
-                        if ( *previous_token == STRING_TOKEN )
+                        /* The last fragment of a string value split across input buffers, or too long for value_length */
+                        if ( ( ( ctx->options & CY_JSON_OPTION_STRING_FRAGMENTS ) != 0 ) && ( ctx->fragmented || ( token_length > JSON_FRAGMENT_MAX_LENGTH ) ) )
                         {
-                            type = JSON_STRING_TYPE;
-
-                            value_end = previous_token - 1;
-                            value_start = string_start + 1;
-                        }
-                        else if ( *previous_token == ARRAY_END_TOKEN )
-                        {
-                            if ( string_start )
+                            result = json_fragment_report( ctx, token, token_length, true, &reported );
+                            if ( result == CY_RSLT_JSON_SKIP )
                             {
-                                type = JSON_STRING_TYPE;
-                                value_start = string_start + 1;
-                                value_end = string_end - 1;
+                                json_release_value( ctx );
+                                json_skip_innermost( ctx );
+                                current_input_token++;
+                                result = CY_RSLT_SUCCESS;
+                                break;
                             }
-                            else
+                            if ( result != CY_RSLT_SUCCESS )
                             {
-                                type = JSON_NUMBER_TYPE;
-
-                                /* Keep moving the value end token back till you encounter a digit */
-                                while ( ( *value_end < '0' ) || ( *value_end > '9' ) )
-                                {
-                                    value_end--;
-                                }
-
-                                value_start = value_end;
-
-                                while ( ( *value_start >= '0' ) && ( *value_start <= '9' ) )
-                                {
-                                    value_start--;
-                                }
-
-                                value_start++;
+                                break;
                             }
+                            token        += reported;
+                            token_length -= reported;
+                            ctx->fragment = CY_JSON_FRAGMENT_LAST;
                         }
-                        else if ( *previous_token == TRUE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
-
-                            value_end = previous_token + sizeof( "true" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == FALSE_TOKEN )
-                        {
-                            type = JSON_BOOLEAN_TYPE;
-
-                            value_end = previous_token + sizeof( "false" ) - 2;
-                            value_start = previous_token;
-                        }
-                        else if ( *previous_token == NULL_TOKEN )
+                        result = json_value_complete( ctx, JSON_STRING_TYPE, token, token_length );
+                        if ( result != CY_RSLT_SUCCESS )
                         {
-                            type = JSON_NULL_TYPE;
-                            value_end = previous_token + sizeof( "null" ) - 2;
-                            value_start = previous_token;
+                            break;
                         }
-                        else
-                        {
-                            type = JSON_NUMBER_TYPE;
+                    }
+                }
+                else
+                {
+                    /* Control characters must be escaped */
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    break;
+                }
+                current_input_token++;
+                break;
 
-                            /* Keep moving the value end token back till you encounter a digit */
-                            while ( ( ( *value_end < '0' ) || ( *value_end > '9' ) ) )
-                            {
-                                value_end--;
-                            }
+            case JSON_STATE_STRING_ESCAPE:
+                if ( *current_input_token == 'u' )
+                {
+                    ctx->sub_state    = 0;
+                    ctx->escape_value = 0;
+                    ctx->escape_held++;
+                    ctx->state        = JSON_STATE_STRING_UNICODE;
+                }
+                else if ( ( *current_input_token == STRING_TOKEN ) || ( *current_input_token == ESCAPE_TOKEN ) || ( *current_input_token == '/' ) ||
+                          ( *current_input_token == 'b' ) || ( *current_input_token == 'f' ) || ( *current_input_token == 'n' ) ||
+                          ( *current_input_token == 'r' ) || ( *current_input_token == 't' ) )
+                {
+                    ctx->surrogate_pending = false;
+                    ctx->escape_held       = 0;
+                    ctx->state             = JSON_STATE_STRING;
+                }
+                else
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    break;
+                }
+                current_input_token++;
+                break;
 
-                            value_start = value_end;
+            case JSON_STATE_STRING_UNICODE:
+                if ( !JSON_IS_HEX_DIGIT( *current_input_token ) )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    break;
+                }
+                ctx->escape_value = (uint16_t)( ( ctx->escape_value << 4 ) | (uint32_t)( JSON_IS_DIGIT( *current_input_token ) ?
+                                    ( *current_input_token - '0' ) : ( ( *current_input_token | 0x20 ) - 'a' + 10 ) ) );
+                ctx->escape_held++;
+                if ( ++ctx->sub_state == 4 )
+                {
+                    /* A high surrogate is held with the escape sequence which follows it, if any */
+                    if ( ( ctx->escape_value & 0xFC00 ) == 0xD800 )
+                    {
+                        ctx->escape_held       = ( ctx->surrogate_pending ) ? 6 : ctx->escape_held;
+                        ctx->surrogate_pending = true;
+                    }
+                    else
+                    {
+                        ctx->escape_held       = 0;
+                        ctx->surrogate_pending = false;
+                    }
+                    ctx->state = JSON_STATE_STRING;
+                }
+                current_input_token++;
+                break;
 
-                            while ( ( ( *value_start >= '0' ) && ( *value_start <= '9' ) ) || ( *value_start == '.' ) || ( *value_start == '-' ) )
-                            {
-                                value_start--;
-                            }
+            case JSON_STATE_NUMBER:
+                while ( ( current_input_token < end_of_input ) && json_number_next( ctx, *current_input_token ) )
+                {
+                    current_input_token++;
+                }
+                if ( current_input_token == end_of_input )
+                {
+                    break;
+                }
 
-                            value_start++;
-                        }
+                /* The number ends at the first character that is not part of it */
+                if ( !json_number_is_complete( ctx->sub_state ) )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    break;
+                }
+                result = json_token_complete( ctx, json_input, current_input_token, &token, &token_length );
+                if ( result != CY_RSLT_SUCCESS )
+                {
+                    break;
+                }
+                result = json_value_complete( ctx, JSON_NUMBER_TYPE, token, token_length );
+                break;
 
-                        json_object.value_type = type;
-                        json_object.value = value_start;
-                        json_object.value_length = value_end - value_start + 1;
+            case JSON_STATE_LITERAL:
+                if ( *current_input_token != ctx->literal[ ctx->sub_state ] )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    break;
+                }
+                current_input_token++;
+
+                if ( ctx->literal[ ++ctx->sub_state ] == '\0' )
+                {
+                    /* The event handler gets the literal in place when it is complete in this input buffer */
+                    token = (char*)ctx->literal;
+                    if ( ( ctx->event_handler != NULL ) && ( (uint32_t)( current_input_token - json_input ) >= ctx->sub_state ) )
+                    {
+                        token = (char*)( current_input_token - ctx->sub_state );
+                    }
 
-                        if ( internal_json_callback != NULL )
-                        {
-                            str_convertor( &json_object );
-                            internal_json_callback( &json_object, internal_json_argument );
-                        }
+                    result = json_value_complete( ctx, ( ctx->literal == json_null_literal ) ? JSON_NULL_TYPE : JSON_BOOLEAN_TYPE, token, ctx->sub_state );
+                }
+                break;
 
-                        string_start = NULL;
-                        string_end = NULL;
-                        value_start = NULL;
-                        value_end = NULL;
-                        type = UNKNOWN_JSON_TYPE;
+            case JSON_STATE_SKIP:
+                /* Only brackets and strings matter until the end of the skipped object or array */
+                current_input_token = cy_json_scan_skip( current_input_token, end_of_input );
+                if ( current_input_token == end_of_input )
+                {
+                    break;
+                }
+
+                if ( *current_input_token == STRING_TOKEN )
+                {
+                    ctx->state = JSON_STATE_SKIP_STRING;
+                }
+                else if ( ( *current_input_token == OBJECT_START_TOKEN ) || ( *current_input_token == ARRAY_START_TOKEN ) )
+                {
+                    ctx->skip_depth++;
+                }
+                else if ( --ctx->skip_depth == 0 )
+                {
+                    ctx->state = JSON_STATE_COMMA_OR_END;
+                    if ( ctx->depth == 0 )
+                    {
+                        result = json_record_complete( ctx );
                     }
+                }
+                current_input_token++;
+                break;
 
-                    previous_token = current_input_token;
-
+            case JSON_STATE_SKIP_STRING:
+                current_input_token = cy_json_scan_string( current_input_token, end_of_input );
+                if ( current_input_token == end_of_input )
+                {
                     break;
+                }
+
+                if ( *current_input_token == ESCAPE_TOKEN )
+                {
+                    ctx->state = JSON_STATE_SKIP_ESCAPE;
+                }
+                else if ( *current_input_token == STRING_TOKEN )
+                {
+                    ctx->state = JSON_STATE_SKIP;
+                }
+                current_input_token++;
+                break;
 
-                case ESCAPE_TOKEN:
-                    /* Clear escape token flag, if the previous token is an escape token. Else set it */
-                    escape_token = ( escape_token == true ) ? false : true;
+            case JSON_STATE_SKIP_ESCAPE:
+                ctx->state = JSON_STATE_SKIP_STRING;
+                current_input_token++;
+                break;
 
+            default:
+                current_input_token = cy_json_scan_whitespace( current_input_token, end_of_input );
+                if ( current_input_token == end_of_input )
+                {
                     break;
+                }
+                result = json_structural( ctx, current_input_token );
+                current_input_token++;
+                break;
+        }
 
-                default:
-                    /* Reset escape token flag */
-                    escape_token = false;
-                    if ( ( object_counter == 0 ) && ( array_counter == 0 ) && ( *current_input_token  != ' ' ) &&
-                         ( JSON_IS_NOT_ESC_CHAR ( *current_input_token ) ) )
-                    {
-                        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                        object_counter = 0;
-                        array_counter = 0;
-                        return valid_json_string;
-                    }
-                    break;
-            } // switch
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            json_parser_abort( ctx, (uint32_t)( current_input_token - json_input ), start );
+            return result;
+        }
 
-            /* Counting spaces*/
-            if ( *( current_input_token ) == ' ' )
-            {
-                space++;
-            }
-            else
-            {
-                space = 0;
-            }
-            current_input_token++;
-            if ( ( *( current_input_token ) == '\0' ) && ( ( ( *( previous_token ) == COMMA_SEPARATOR ) || ( *( previous_token ) == STRING_TOKEN ) || ( *( previous_token ) == START_OF_VALUE ) || ( *( previous_token ) == ARRAY_START_TOKEN ) ) ) )
+        if ( ctx->pause )
+        {
+            ctx->pause = false;
+            *consumed  = (uint32_t)( current_input_token - json_input );
+            if ( ctx->statistics != NULL )
             {
-                valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-                object_counter = 0;
-                array_counter = 0;
-                return valid_json_string;
+                json_statistics_parse( ctx, *consumed, start );
             }
-        } // while
-    }     // if
-    else
+            return CY_JSON_EVENT_RSLT_PAUSED;
+        }
+    }
+
+    *consumed = input_length;
+
+    /* Nothing is pending once the JSON document is complete */
+    if ( ( ctx->state == JSON_STATE_START ) && ( ctx->depth == 0 ) )
+    {
+        if ( ctx->statistics != NULL )
+        {
+            json_statistics_parse( ctx, input_length, start );
+        }
+        return CY_RSLT_SUCCESS;
+    }
+
+    /* The JSON document continues in the next input buffer */
+    result = json_parser_suspend( ctx, json_input, end_of_input );
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        json_parser_abort( ctx, input_length, start );
+        return result;
+    }
+
+    if ( ctx->statistics != NULL )
     {
-        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-        return valid_json_string;
+        json_statistics_parse( ctx, input_length, start );
     }
 
-    /* This means that a closing brace has not been found for an object. This data is split across packets */
-    if ( object_counter || array_counter )
+    return CY_RSLT_JSON_INCOMPLETE;
+}
+
+
+cy_rslt_t cy_JSON_unescape( const char* input, uint32_t input_length, char* output, uint32_t output_size, uint32_t* output_length )
+{
+    const char* end = input + input_length;
+    const char* escape;
+    uint32_t    used = 0;
+    uint32_t    length;
+    uint32_t    code_point;
+    uint32_t    low;
+    char        decoded[ 4 ];
+
+    if ( ( ( input == NULL ) && ( input_length != 0 ) ) || ( ( output == NULL ) && ( output_size != 0 ) ) || ( output_length == NULL ) )
     {
-        memset( packet_backup, 0x0, sizeof( packet_backup ) );
+        return CY_RSLT_JSON_BADARG;
+    }
 
-        // Copy everything from the most recent unfinished object onwards
+    while ( input < end )
+    {
+        /* Copy the characters up to the next escape sequence in one go */
+        escape = memchr( input, ESCAPE_TOKEN, (size_t)( end - input ) );
+        if ( escape == NULL )
+        {
+            escape = end;
+        }
 
-        number_of_bytes_backed_up = end_of_input - most_recent_object_marker;
+        length = (uint32_t)( escape - input );
+        if ( length > output_size - used )
+        {
+            return CY_RSLT_JSON_BUFFER_OVERFLOW;
+        }
+        if ( output + used != input )
+        {
+            memmove( output + used, input, length );
+        }
+        used  += length;
+        input  = escape;
 
-        if( most_recent_object_marker != NULL )
+        if ( input == end )
         {
-            memcpy( packet_backup, most_recent_object_marker, number_of_bytes_backed_up );
+            break;
         }
 
-        incomplete_response = true;
-        valid_json_string = CY_RSLT_JSON_GENERIC_ERROR;
-        object_counter      = 0;
+        /* The whole escape sequence is read before writing, so that the output never overtakes the input */
+        if ( end - input < 2 )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
 
-        return valid_json_string;
-    }
+        length = 1;
+        switch ( input[ 1 ] )
+        {
+            case STRING_TOKEN:
+            case ESCAPE_TOKEN:
+            case '/':
+                decoded[ 0 ] = input[ 1 ];
+                break;
 
+            case 'b':
+                decoded[ 0 ] = '\b';
+                break;
 
-    memset( &parent_json_object, 0x0, sizeof( parent_json_object ) );
+            case 'f':
+                decoded[ 0 ] = '\f';
+                break;
 
-    incomplete_response = false;
+            case 'n':
+                decoded[ 0 ] = '\n';
+                break;
 
-    object_counter      = 0;
+            case 'r':
+                decoded[ 0 ] = '\r';
+                break;
 
-    string_start        = NULL;
-    string_end          = NULL;
+            case 't':
+                decoded[ 0 ] = '\t';
+                break;
 
-    value_start         = NULL;
-    value_end           = NULL;
+            case 'u':
+                if ( ( end - input < 6 ) || ( ( code_point = json_hex_value( input + 2 ) ) > 0xFFFF ) )
+                {
+                    return CY_RSLT_JSON_GENERIC_ERROR;
+                }
+                input += 4;
+
+                if ( ( code_point >= 0xD800 ) && ( code_point <= 0xDBFF ) && ( end - input >= 8 ) && ( input[ 2 ] == ESCAPE_TOKEN ) &&
+                     ( input[ 3 ] == 'u' ) && ( ( low = json_hex_value( input + 4 ) ) >= 0xDC00 ) && ( low <= 0xDFFF ) )
+                {
+                    code_point = 0x10000 + ( ( code_point - 0xD800 ) << 10 ) + ( low - 0xDC00 );
+                    input     += 6;
+                }
+                else if ( ( code_point >= 0xD800 ) && ( code_point <= 0xDFFF ) )
+                {
+                    /* Unpaired surrogate */
+                    code_point = 0xFFFD;
+                }
+                length = json_utf8_encode( code_point, decoded );
+                break;
 
-    type                = UNKNOWN_JSON_TYPE;
+            default:
+                return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        input += 2;
 
-    escape_token        = false;
+        if ( length > output_size - used )
+        {
+            return CY_RSLT_JSON_BUFFER_OVERFLOW;
+        }
+        memcpy( output + used, decoded, length );
+        used += length;
+    }
 
-    previous_token      = NULL;
+    *output_length = used;
 
-    return valid_json_string;
+    return CY_RSLT_SUCCESS;
 }
@@ -57,6 +57,38 @@ extern "C" {
 /******************************************************
  *                      Macros
  ******************************************************/
+/** Maximum nesting depth of objects and arrays in a JSON document, unless a stack is set with @ref cy_JSON_parser_ctx_set_stack */
+#ifndef CY_JSON_MAX_DEPTH
+#define CY_JSON_MAX_DEPTH         (8)
+#endif
+
+/** Maximum number of segments of a JSON path pattern */
+#ifndef CY_JSON_PATH_MAX_SEGMENTS
+#define CY_JSON_PATH_MAX_SEGMENTS (8)
+#endif
+
+/** Maximum nesting depth of objects and arrays accepted by @ref cy_JSON_validate. Costs one bit of stack per level */
+#ifndef CY_JSON_VALIDATE_MAX_DEPTH
+#define CY_JSON_VALIDATE_MAX_DEPTH (1024)
+#endif
+
+#ifdef CY_JSON_FIXED_POINT
+/** Fractional bits of the fixedval field of @ref cy_JSON_object_t, in Q format, unless CY_JSON_FIXED_POINT_DECIMALS
+ *  is defined as the number of decimals fixedval is scaled by. fixedval is present when CY_JSON_FIXED_POINT is defined,
+ *  for targets without an FPU: the numbers reported to callbacks are then converted with integer arithmetic only, and
+ *  their doubleval and floatval fields are 0. The decoder, cursor and CBOR utilities still convert numbers to doubles
+ *  for floating-point destinations, with big integer arithmetic for the numbers which cannot be converted exactly
+ *  otherwise: build with -ffunction-sections and link with --gc-sections to leave this conversion out of applications
+ *  which do not use it.
+ */
+#ifndef CY_JSON_FIXED_POINT_FRACTION_BITS
+#define CY_JSON_FIXED_POINT_FRACTION_BITS (16)
+#endif
+
+#if !defined( CY_JSON_FIXED_POINT_DECIMALS ) && ( ( CY_JSON_FIXED_POINT_FRACTION_BITS < 0 ) || ( CY_JSON_FIXED_POINT_FRACTION_BITS > 31 ) )
+#error "CY_JSON_FIXED_POINT_FRACTION_BITS must be between 0 and 31"
+#endif
+#endif
 
 /******************************************************
  *                    Constants
@@ -66,6 +98,52 @@ extern "C" {
 #define CY_RSLT_JSON_ERROR_BASE                     CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_JSON_BASE, CY_RSLT_MODULE_JSON_ERR_CODE_START)
 
 #define CY_RSLT_JSON_GENERIC_ERROR                  ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 1)) /** JSON parser generic error result */
+#define CY_RSLT_JSON_BADARG                         ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 2)) /** JSON parser bad argument */
+#define CY_RSLT_JSON_INCOMPLETE                     ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 3)) /** JSON document continues in the next input buffer */
+#define CY_RSLT_JSON_BUFFER_OVERFLOW                ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 4)) /** Buffer provided by the application is too small */
+#define CY_RSLT_JSON_NOT_FOUND                      ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 5)) /** Requested member or element does not exist */
+#define CY_RSLT_JSON_TYPE_MISMATCH                  ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 6)) /** JSON value does not match the type of the destination */
+#define CY_RSLT_JSON_DEPTH_EXCEEDED                 ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 7)) /** Objects and arrays are nested deeper than the parser stack */
+#define CY_RSLT_JSON_ABORTED                        ((cy_rslt_t)(CY_RSLT_JSON_ERROR_BASE + 8)) /** Parse stopped by the callback */
+
+/** Returned by a callback to skip the rest of the object or array holding the value reported, or the array reported */
+#define CY_RSLT_JSON_SKIP                           CY_RSLT_CREATE(CY_RSLT_TYPE_INFO, CY_RSLT_MODULE_JSON_BASE, 1)
+
+/** Maximum number of JSON path patterns subscribed on a JSON parser context */
+#define CY_JSON_MAX_PATHS         (32)
+
+/** Parser option: decode the escape sequences of member names and string values before reporting them, see @ref cy_JSON_parser_ctx_set_options */
+#define CY_JSON_OPTION_DECODE_ESCAPES   (1UL << 0)
+
+/** Parser option: report the string values split across input buffers in fragments, see @ref cy_JSON_parser_ctx_set_options */
+#define CY_JSON_OPTION_STRING_FRAGMENTS (1UL << 1)
+
+/** Parser option: report the hash of the path of each value, see @ref cy_JSON_parser_ctx_set_options */
+#define CY_JSON_OPTION_PATH_HASH        (1UL << 2)
+
+/** Parser option: include the positions of array elements in the hash of the path, see @ref cy_JSON_parser_ctx_set_options */
+#define CY_JSON_OPTION_PATH_HASH_INDEX  (1UL << 3)
+
+/** Hash of the empty path, the path of the document root: the FNV-1a offset basis */
+#define CY_JSON_PATH_HASH_INIT          (2166136261UL)
+
+/** FNV-1a prime, by which the hash of a path is multiplied after each character */
+#define CY_JSON_PATH_HASH_PRIME         (16777619UL)
+
+/** Fragment flags of a value reported whole */
+#define CY_JSON_FRAGMENT_NONE           (0x00)
+
+/** Fragment flags of the first fragment of a string value */
+#define CY_JSON_FRAGMENT_FIRST          (0x01)
+
+/** Fragment flags of a fragment of a string value which is neither the first nor the last */
+#define CY_JSON_FRAGMENT_MIDDLE         (0x02)
+
+/** Fragment flags of the last fragment of a string value */
+#define CY_JSON_FRAGMENT_LAST           (0x04)
+
+/** Path segment index matching any member of an object ("*") or any element of an array ("[*]") */
+#define CY_JSON_PATH_ANY          (0xFFFFFFFFUL)
 
 #define OBJECT_START_TOKEN        '{'
 #define OBJECT_END_TOKEN          '}'
@@ -126,6 +204,13 @@ typedef enum
 /******************************************************
  *                    Structures
  ******************************************************/
+/** Segment of JSON data, for instance one buffer of an lwIP pbuf chain or of a NetX Duo NX_PACKET chain */
+typedef struct
+{
+    const char*         data;                 /**< Pointer to the JSON data of the segment */
+    uint32_t            length;               /**< Length of the JSON data of the segment */
+} cy_JSON_segment_t;
+
 /** JSON parser object */
 typedef struct cy_JSON_object {
 
@@ -138,6 +223,15 @@ typedef struct cy_JSON_object {
     float               floatval;             /**< JSON float value parsed */
     bool                boolval;              /**< JSON boolean value parsed */
     struct cy_JSON_object* parent_object;     /**< Pointer to parent JSON object */
+    int64_t             int64val;             /**< JSON number value parsed, as a 64-bit integer. Saturated if out of range, truncated toward zero if not an integer */
+    uint64_t            uint64val;            /**< JSON number value parsed, as an unsigned 64-bit integer. Saturated if out of range, truncated toward zero if not an integer */
+    double              doubleval;            /**< JSON number value parsed, as a double, correctly rounded whatever the locale */
+    uint8_t             fragment;             /**< CY_JSON_FRAGMENT_ flags of a string value reported in fragments, CY_JSON_FRAGMENT_NONE otherwise */
+    uint32_t            path_hash;            /**< Hash of the path of the value with CY_JSON_OPTION_PATH_HASH, see @ref cy_JSON_path_hash. 0 otherwise */
+    bool                exact_integer;        /**< Set for numbers: true if the number is an integer held exactly by int64val, or by uint64val if it is not negative */
+#ifdef CY_JSON_FIXED_POINT
+    int32_t             fixedval;             /**< JSON number value parsed, in the fixed-point format set by CY_JSON_FIXED_POINT_DECIMALS or CY_JSON_FIXED_POINT_FRACTION_BITS. Rounded to nearest, saturated if out of range */
+#endif
 } cy_JSON_object_t;
 
 /** Callback function used for registering with JSON parse
@@ -145,10 +239,152 @@ typedef struct cy_JSON_object {
  * @param[in] json_object : JSON object which contains the key=value pair parsed by the JSON parser
  * @param[in] arg         : User argument passed in when registering the callback
  *
- * @return cy_rslt_t
+ * @return CY_RSLT_SUCCESS to continue parsing
+ *         CY_RSLT_JSON_SKIP to skip the rest of the object or array holding the value, without parsing it. When an array
+ *         is reported, its contents are skipped. Parsing continues after the end of the object or array.
+ *         Any other value, such as CY_RSLT_JSON_ABORTED, stops the parse immediately and is returned by the parser
  */
 typedef cy_rslt_t (*cy_JSON_callback_t)( cy_JSON_object_t* json_object, void *arg );
 
+/** Callback invoked at the end of each top-level JSON document, or record, parsed with a JSON parser context
+ *
+ * @param[in] record : Index of the record, from 0, counted since the context was initialized or reset
+ * @param[in] arg    : User argument passed in when registering the callback
+ *
+ * @return CY_RSLT_SUCCESS to continue parsing with the next record.
+ *         Any other value stops the parse immediately and is returned by the parser
+ */
+typedef cy_rslt_t (*cy_JSON_record_callback_t)( uint32_t record, void* arg );
+
+/** Clock used to time the parses of a JSON parser context, such as a cycle counter or a microsecond timer
+ *
+ * @param[in] arg : User argument passed in when setting the clock
+ *
+ * @return Free-running count of clock units. The parse time is the difference of two counts, so the count may wrap
+ */
+typedef uint32_t (*cy_JSON_clock_t)( void* arg );
+
+/** Statistics of the parses of a JSON parser context, see @ref cy_JSON_parser_ctx_set_statistics */
+typedef struct
+{
+    uint32_t            parse_calls;                   /**< Calls parsing an input buffer with the context */
+    uint64_t            bytes_scanned;                 /**< Bytes of input parsed */
+    uint32_t            tokens[ UNKNOWN_JSON_TYPE ];   /**< Values, objects and arrays parsed, indexed by @ref cy_JSON_type_t. Numbers are counted as JSON_NUMBER_TYPE */
+    uint32_t            keys;                          /**< Member names parsed */
+    uint32_t            callbacks;                     /**< Calls to the callback, the callbacks of subscribed paths and the record callback */
+    uint32_t            max_depth;                     /**< Deepest nesting of objects and arrays reached */
+    uint32_t            buffer_copies;                 /**< Copies into the token buffer, of tokens and names split across input buffers */
+    uint64_t            buffer_bytes;                  /**< Bytes copied into the token buffer */
+    uint32_t            dropped_documents;             /**< Partial JSON documents dropped on an error */
+    uint64_t            parse_time;                    /**< Clock units spent parsing, with a clock */
+    uint32_t            max_parse_time;                /**< Longest parse of a single input buffer, in clock units, with a clock */
+} cy_JSON_statistics_t;
+
+struct cy_JSON_parser_ctx;
+
+/** Handler receiving every value, object and array parsed with a JSON parser context. Internal to the JSON parser.
+ *
+ * @param[in] ctx         : JSON parser context
+ * @param[in] event       : Parse event
+ * @param[in] json_object : Value, object or array the event refers to
+ * @param[in] arg         : Argument passed in when installing the handler
+ *
+ * @return CY_RSLT_SUCCESS to continue parsing, any other value stops the parse and is returned by the parser
+ */
+typedef cy_rslt_t (*cy_JSON_event_handler_t)( struct cy_JSON_parser_ctx* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg );
+
+/** Segment of a compiled JSON path pattern */
+typedef struct
+{
+    const char*         key;              /**< Member name, NULL for an array element */
+    uint32_t            key_length;       /**< Length of the member name */
+    uint32_t            index;            /**< Position of the array element, or CY_JSON_PATH_ANY. For members, 0 or CY_JSON_PATH_ANY */
+} cy_JSON_path_segment_t;
+
+/** Compiled JSON path pattern, see @ref cy_JSON_path_compile */
+typedef struct
+{
+    cy_JSON_path_segment_t  segments[ CY_JSON_PATH_MAX_SEGMENTS ];  /**< Segments of the path, from the document root */
+    uint32_t                segment_count;                          /**< Number of segments */
+    cy_JSON_callback_t      callback;                               /**< Callback invoked for the values matching the path */
+    void*                   argument;                               /**< User argument passed to the callback */
+} cy_JSON_path_t;
+
+/** Number being parsed. Internal to the JSON parser. */
+typedef struct
+{
+    uint64_t            mantissa;          /**< Decimal digits of the number, up to the capacity of 64 bits */
+    int32_t             exponent;          /**< Decimal exponent of the mantissa, from the fraction digits and the dropped digits */
+    uint32_t            explicit_exponent; /**< Value of the exponent part of the number */
+    bool                negative;          /**< Set for a negative number */
+    bool                exponent_negative; /**< Set for a negative exponent part */
+    bool                truncated;         /**< Set when non-zero digits were dropped from the mantissa */
+} cy_JSON_number_t;
+
+/** Nesting level of the JSON parser. Internal to the JSON parser. */
+typedef struct
+{
+    cy_JSON_object_t    record;           /**< Container description, reported as parent_object of its members */
+    cy_JSON_object_t*   member_parent;    /**< parent_object reported for the members of the container */
+    uint32_t            mark;             /**< Token buffer usage before the name of the container */
+    uint32_t            paths;            /**< Subscribed paths which may match members or elements of the container */
+    uint32_t            count;            /**< Number of members or elements of the container started so far */
+    uint16_t            name_length;      /**< Length of the name of the container */
+    uint8_t             container;        /**< OBJECT_START_TOKEN or ARRAY_START_TOKEN */
+} cy_JSON_parser_level_t;
+
+/** JSON parser context
+ *
+ * Holds the complete state of one JSON parse, so that independent JSON streams can be parsed
+ * concurrently by using one context per stream. The members are internal to the JSON parser
+ * and must not be accessed directly by the application.
+ */
+typedef struct cy_JSON_parser_ctx
+{
+    cy_JSON_callback_t      callback;                        /**< Callback registered with this context */
+    void*                   argument;                        /**< User argument passed to the callback */
+    cy_JSON_event_handler_t event_handler;                   /**< Event handler used in place of the callback by the library */
+    void*                   event_argument;                  /**< Argument passed to the event handler */
+    cy_JSON_record_callback_t record_callback;               /**< Callback invoked at the end of each record */
+    void*                   record_argument;                 /**< User argument passed to the record callback */
+    uint32_t                record_count;                    /**< Number of records parsed since the context was initialized or reset */
+    cy_JSON_object_t        json_object;                     /**< JSON object reported to the callback */
+    cy_JSON_parser_level_t* levels;                          /**< Parser stack: objects and arrays currently open */
+    uint32_t                max_depth;                       /**< Number of levels of the parser stack */
+    uint32_t                depth;                           /**< Number of objects and arrays currently open */
+    uint8_t                 state;                           /**< Parser state */
+    uint8_t                 sub_state;                       /**< Position inside a number, literal or escape sequence */
+    bool                    string_is_key;                   /**< Set while parsing a member name */
+    bool                    string_escaped;                  /**< Set when the string being parsed contains an escape sequence */
+    bool                    fragmented;                      /**< Set once the first fragment of the string being parsed has been reported */
+    bool                    surrogate_pending;               /**< Set after a \u escape of a high surrogate, until the next character */
+    uint8_t                 fragment;                        /**< CY_JSON_FRAGMENT_ flags of the value being reported */
+    uint8_t                 escape_held;                     /**< Length of the escape sequence being parsed, including a pending high surrogate */
+    uint16_t                escape_value;                    /**< Value of the \u escape being parsed */
+    bool                    token_in_buffer;                 /**< Set when the current token started in a previous input buffer */
+    const char*             literal;                         /**< Literal (true, false or null) being parsed */
+    char*                   key;                             /**< Member name of the value being parsed */
+    uint16_t                key_length;                      /**< Length of the member name */
+    uint32_t                value_length;                    /**< Length of the value reported to the event handler */
+    uint32_t                path_hash;                       /**< Hash of the path of the value being parsed, with CY_JSON_OPTION_PATH_HASH */
+    cy_JSON_number_t        number;                          /**< Number being parsed */
+    char*                   token_start;                     /**< Start of the current token in the input buffer */
+    uint32_t                token_offset;                    /**< Start of the current token in the token buffer */
+    char*                   token_buffer;                    /**< Buffer holding the data split across input buffers */
+    uint32_t                token_buffer_size;               /**< Size of the token buffer */
+    uint32_t                token_buffer_used;               /**< Number of bytes used in the token buffer */
+    uint32_t                stack_used;                      /**< Number of bytes used in the token buffer by container names */
+    const cy_JSON_path_t*   paths;                           /**< Subscribed JSON paths */
+    uint32_t                path_count;                      /**< Number of subscribed JSON paths */
+    uint32_t                skip_depth;                      /**< Nesting depth inside an object or array being skipped */
+    bool                    pause;                           /**< Set by the event handler to stop the parse after the current event */
+    uint32_t                options;                         /**< CY_JSON_OPTION_ flags */
+    cy_JSON_statistics_t*   statistics;                      /**< Statistics updated by the parser, NULL if there are none */
+    cy_JSON_clock_t         clock;                           /**< Clock timing the parses, NULL if there is none */
+    void*                   clock_argument;                  /**< User argument passed to the clock */
+    cy_JSON_parser_level_t  default_levels[ CY_JSON_MAX_DEPTH ]; /**< Parser stack used unless one is set by the application */
+} cy_JSON_parser_ctx_t;
+
 /** \} */
 
 #define JSON_IS_NOT_ESC_CHAR( ch ) ( ( ch != '\b' )  &&  \
@@ -176,6 +412,259 @@ typedef cy_rslt_t (*cy_JSON_callback_t)( cy_JSON_object_t* json_object, void *ar
 /*****************************************************************************/
 
 
+/** Initialize a JSON parser context
+ *
+ * A context holds all the state of a JSON parse. Each context can be used by one thread at a time;
+ * independent JSON streams can be parsed concurrently by using one context per stream.
+ *
+ * @param[in] ctx : Pointer to the JSON parser context to be initialized
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_init( cy_JSON_parser_ctx_t* ctx );
+
+/** Reset a JSON parser context
+ *
+ * Discards any partially parsed JSON data held by the context. The registered callback and token buffer are retained.
+ *
+ * @param[in] ctx : Pointer to an initialized JSON parser context
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_reset( cy_JSON_parser_ctx_t* ctx );
+
+/** Set the token buffer of a JSON parser context
+ *
+ * A JSON document may be passed to the parser in several input buffers, for instance as it arrives from the network.
+ * Parsing stops at the end of each input buffer and resumes with the next one, without copying the document.
+ * Only the data which is still needed when an input buffer ends is copied into the token buffer: the names of the
+ * objects and arrays currently open, the pending member name, and the key, string or number split across the two
+ * input buffers. The size of the token buffer therefore bounds the length of a token which can be split across input
+ * buffers, not the size of the JSON document.
+ *
+ * A context without a token buffer can only parse JSON documents passed in a single input buffer.
+ *
+ * @param[in] ctx    : Pointer to an initialized JSON parser context
+ * @param[in] buffer : Pointer to the token buffer, or NULL to remove the token buffer
+ * @param[in] size   : Size of the token buffer in bytes
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_set_token_buffer( cy_JSON_parser_ctx_t* ctx, char* buffer, uint32_t size );
+
+/** Set the parser stack of a JSON parser context
+ *
+ * The parser stack holds one level per object or array open, and bounds the nesting depth of the JSON documents the context
+ * can parse. By default, a context uses a stack of CY_JSON_MAX_DEPTH levels held in the context. A larger stack allows deeper
+ * documents to be parsed without raising CY_JSON_MAX_DEPTH, and so the size of every context, for all the use-cases.
+ * JSON documents nested deeper than the stack fail to parse with CY_RSLT_JSON_DEPTH_EXCEEDED.
+ *
+ * Setting the stack discards any partially parsed JSON data held by the context.
+ *
+ * @param[in] ctx        : Pointer to an initialized JSON parser context
+ * @param[in] levels     : Array of parser levels, which must remain valid while used by the context. NULL to use the default stack
+ * @param[in] max_depth  : Number of levels in the `levels` array
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_set_stack( cy_JSON_parser_ctx_t* ctx, cy_JSON_parser_level_t* levels, uint32_t max_depth );
+
+/** Set the options of a JSON parser context
+ *
+ * With CY_JSON_OPTION_DECODE_ESCAPES, member names and string values containing escape sequences are decoded as by
+ * @ref cy_JSON_unescape before they are reported, and their decoded length is reported. The decoding is done in place:
+ * the input buffers must be writable, and are passed to @ref cy_JSON_parser_ctx_parse_in_place, which modifies them.
+ * Strings without escape sequences are reported in place, unchanged and at no extra cost.
+ *
+ * With CY_JSON_OPTION_STRING_FRAGMENTS, a string value split across input buffers is not gathered in the token buffer:
+ * the part received in each input buffer is reported to the callback as soon as the buffer is parsed, as one fragment
+ * of the value. The `fragment` member of the reported object is CY_JSON_FRAGMENT_FIRST, CY_JSON_FRAGMENT_MIDDLE, or
+ * CY_JSON_FRAGMENT_LAST. Fragments are not NUL terminated, and hold at most 65535 bytes: longer string values, even in a
+ * single input buffer, are reported in several fragments. The last fragment may be empty. Escape sequences, and the
+ * surrogate pairs written as two \u escapes, are never split across fragments: the few bytes of an escape sequence
+ * split across input buffers are held in the token buffer until it is complete. String values of any length can thus
+ * be parsed with a token buffer sized for member names. Other values, and string values received in a single input
+ * buffer, are reported whole, with CY_JSON_FRAGMENT_NONE.
+ *
+ * With CY_JSON_OPTION_PATH_HASH, the `path_hash` member of each reported object, and of its parent objects, is the hash
+ * of the path of the value from the document root, as computed by @ref cy_JSON_path_hash: the application can dispatch
+ * the values on a single integer instead of comparing the names of the value and of its parents. The hash is updated
+ * incrementally as objects and arrays are opened. Array elements are hashed as "[*]", or as "[n]" with the position of
+ * the element when CY_JSON_OPTION_PATH_HASH_INDEX is also set. Member names are hashed as they are reported.
+ *
+ * @param[in] ctx     : Pointer to an initialized JSON parser context
+ * @param[in] options : CY_JSON_OPTION_ flags combined with a bitwise or, 0 for none
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_set_options( cy_JSON_parser_ctx_t* ctx, uint32_t options );
+
+/** Register callback to be invoked by JSON parser while parsing the JSON data with the given context
+ *
+ * @param[in] ctx           : Pointer to an initialized JSON parser context
+ * @param[in] json_callback : Pointer to the callback function to be invoked while parsing the JSON data
+ * @param[in] arg           : User argument passed in when registering the callback
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_register_callback( cy_JSON_parser_ctx_t* ctx, cy_JSON_callback_t json_callback, void *arg );
+
+/** Register a callback invoked at the end of each record parsed with the given context
+ *
+ * A JSON parser context parses any number of consecutive top-level objects or arrays, or records, separated by optional
+ * whitespace, such as the lines of newline-delimited JSON. They can be passed in a single input buffer, or split across
+ * input buffers at any position. The values of each record are reported to the callback registered with the context,
+ * then the record callback is invoked, before the next record is parsed.
+ *
+ * @param[in] ctx             : Pointer to an initialized JSON parser context
+ * @param[in] record_callback : Pointer to the callback function, NULL to unregister it
+ * @param[in] arg             : User argument passed to the record callback
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_register_record_callback( cy_JSON_parser_ctx_t* ctx, cy_JSON_record_callback_t record_callback, void* arg );
+
+/** Collect statistics of the parses of a JSON parser context
+ *
+ * The parser counts the bytes it scans, the tokens it parses by type, the callbacks it invokes, the deepest nesting
+ * it reaches, the data it copies into the token buffer and the partial documents it drops on errors. With a clock,
+ * it also measures the time spent in each call parsing an input buffer. The application reads the statistics
+ * structure at any time between parses, and clears it with @ref cy_JSON_parser_ctx_reset_statistics.
+ * Without statistics, the parser only tests a pointer at each update.
+ *
+ * @param[in] ctx        : Pointer to an initialized JSON parser context
+ * @param[in] statistics : Pointer to the statistics, cleared by this function. It must remain valid while it is set on
+ *                         the context. NULL to stop collecting statistics
+ * @param[in] clock      : Optional clock timing the parses, NULL if there is none
+ * @param[in] arg        : User argument passed to the clock
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_set_statistics( cy_JSON_parser_ctx_t* ctx, cy_JSON_statistics_t* statistics, cy_JSON_clock_t clock, void* arg );
+
+/** Clear the statistics of a JSON parser context, see @ref cy_JSON_parser_ctx_set_statistics
+ *
+ * @param[in] ctx : Pointer to an initialized JSON parser context
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG if ctx is NULL or has no statistics
+ */
+cy_rslt_t cy_JSON_parser_ctx_reset_statistics( cy_JSON_parser_ctx_t* ctx );
+
+/** Compile a JSON path pattern
+ *
+ * A pattern is a sequence of segments from the document root. A segment is a member name, "*" for any member of an
+ * object, "[n]" for the element at position n of an array, or "[*]" for any element of an array. Member names are
+ * separated by '.', for instance "state.reported.temp", "jobs[*].id" or "[0].name". Member names are compared with the
+ * name as it appears in the JSON data, and cannot contain '.', '[' or ']'.
+ *
+ * The compiled path refers to `pattern`, which must remain valid while the path is in use.
+ *
+ * @param[out] path     : Pointer to the compiled path
+ * @param[in]  pattern  : NUL terminated path pattern
+ * @param[in]  callback : Callback invoked for the values matching the path
+ * @param[in]  arg      : User argument passed to the callback
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG if the pattern is malformed or has more than CY_JSON_PATH_MAX_SEGMENTS segments
+ */
+cy_rslt_t cy_JSON_path_compile( cy_JSON_path_t* path, const char* pattern, cy_JSON_callback_t callback, void* arg );
+
+/** Compute the hash of the path of a value, as reported with CY_JSON_OPTION_PATH_HASH
+ *
+ * The hash is the 32-bit FNV-1a hash of the path written as a JSON path pattern, see @ref cy_JSON_path_compile, for
+ * instance "state.reported.temp", "jobs[*].id", or "jobs[2].id" with CY_JSON_OPTION_PATH_HASH_INDEX. The hash of the
+ * document root is CY_JSON_PATH_HASH_INIT. Different paths may have the same hash, in particular when member names
+ * contain '.', '[' or ']'.
+ *
+ * @param[in] path   : Path of the value
+ * @param[in] length : Length of the path
+ *
+ * @return Hash of the path
+ */
+uint32_t cy_JSON_path_hash( const char* path, uint32_t length );
+
+/** Subscribe a JSON parser context to a set of JSON paths
+ *
+ * Once subscribed, the parser only invokes the callbacks of the paths matching each value, instead of the callback
+ * registered with @ref cy_JSON_parser_ctx_register_callback. A path ending at an object or an array is reported when the
+ * object or array starts, with a NULL value. Objects and arrays which cannot contain a match of any path are skipped
+ * without parsing their contents: only brackets and strings are tracked, so malformed data inside them is not detected,
+ * and they may be nested deeper than the parser stack allows.
+ *
+ * Subscribing discards any partially parsed JSON data held by the context.
+ *
+ * @param[in] ctx   : Pointer to an initialized JSON parser context
+ * @param[in] paths : Array of compiled paths, which must remain valid while subscribed. NULL to remove the subscriptions
+ * @param[in] count : Number of paths, up to CY_JSON_MAX_PATHS
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_parser_ctx_subscribe( cy_JSON_parser_ctx_t* ctx, const cy_JSON_path_t* paths, uint32_t count );
+
+/** Returns the callback function registered with the given JSON parser context
+ *
+ * @param[in] ctx : Pointer to an initialized JSON parser context
+ *
+ * @return @ref cy_JSON_callback_t
+ */
+cy_JSON_callback_t cy_JSON_parser_ctx_get_callback( cy_JSON_parser_ctx_t* ctx );
+
+/** Parse the JSON data with the given context.
+ *
+ *  Same as @ref cy_JSON_parser, but all the parser state is kept in `ctx`, so several threads can parse
+ *  independent JSON streams at the same time, each with its own context.
+ *
+ * @param[in] ctx          : Pointer to an initialized JSON parser context
+ * @param[in] json_input   : Pointer to the JSON data
+ * @param[in] input_length : Length of the JSON data pointed by `json_input`
+ *
+ * @return on success - CY_RSLT_SUCCESS when the JSON document is complete
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the JSON document continues in the next input buffer
+ *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if the data split across input buffers does not fit in the token buffer
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than the parser stack
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON data is malformed
+ *                    - CY_RSLT_JSON_BADARG, also if the context has the CY_JSON_OPTION_DECODE_ESCAPES option
+ *                    - The result of a callback which stopped the parse, see @ref cy_JSON_callback_t
+ */
+cy_rslt_t cy_JSON_parser_ctx_parse( cy_JSON_parser_ctx_t* ctx, const char* json_input, uint32_t input_length );
+
+/** Parse JSON data held in a writable buffer with the given context
+ *
+ *  Same as @ref cy_JSON_parser_ctx_parse, and required for a context with the CY_JSON_OPTION_DECODE_ESCAPES option:
+ *  the escape sequences of member names and string values are decoded in place, in `json_input`.
+ *
+ * @param[in] ctx          : Pointer to an initialized JSON parser context
+ * @param[in] json_input   : Pointer to the JSON data, which may be modified
+ * @param[in] input_length : Length of the JSON data pointed by `json_input`
+ *
+ * @return Same as @ref cy_JSON_parser_ctx_parse
+ */
+cy_rslt_t cy_JSON_parser_ctx_parse_in_place( cy_JSON_parser_ctx_t* ctx, char* json_input, uint32_t input_length );
+
+/** Parse JSON data split into a list of segments with the given context
+ *
+ *  Same as calling @ref cy_JSON_parser_ctx_parse with each segment in turn: the segments are parsed in place, and only
+ *  the tokens straddling two segments are copied, into the token buffer of the context. A document may continue in the
+ *  next list of segments, and a list may hold several documents.
+ *
+ * @param[in] ctx           : Pointer to an initialized JSON parser context
+ * @param[in] segments      : Array of segments of JSON data, in order
+ * @param[in] segment_count : Number of segments. Segments of length 0 are ignored.
+ *
+ * @return Same as @ref cy_JSON_parser_ctx_parse, for the last segment or for the segment where the parse stopped
+ */
+cy_rslt_t cy_JSON_parser_ctx_parse_segments( cy_JSON_parser_ctx_t* ctx, const cy_JSON_segment_t* segments, uint32_t segment_count );
+
 /** Register callback to be invoked by JSON parser while parsing the JSON data
  *
  * @param[in] json_callback : Pointer to the callback function to be invoked while parsing the JSON data
@@ -196,15 +685,106 @@ cy_JSON_callback_t cy_JSON_parser_get_callback( void );
  *  This function will parse the JSON input string through a single parse, calling a callback whenever it encounters milestones
  *  an object, passing in object name, JSON value type, and a value (if value is string or number )
  *
+ *  A JSON document split across several input buffers is parsed by calling this function with each buffer in turn.
+ *  CY_RSLT_JSON_INCOMPLETE is returned until the end of the document is reached. The value and object_string pointers
+ *  passed to the callback are only valid during the callback.
+ *
+ *  The callback can stop the parse, or skip the rest of an object or array, through its return value: see
+ *  @ref cy_JSON_callback_t.
+ *
+ *  This function uses a parser context shared by the whole application. Use @ref cy_JSON_parser_ctx_parse
+ *  to parse several JSON streams concurrently.
+ *
  * @param[in] json_input   : Pointer to the JSON data
  * @param[in] input_length : Length of the JSON data pointed by `json_input1`
  *
  * @return cy_rslt_t
  *
- * @note: Currently escape values are not supported.
+ * @note: Escape sequences are reported as they appear in the JSON data. Use @ref cy_JSON_unescape to decode them, or
+ *        a parser context with the CY_JSON_OPTION_DECODE_ESCAPES option.
  */
 cy_rslt_t cy_JSON_parser( const char* json_input, uint32_t input_length );
 
+/** Parse JSON data split into a list of segments.
+ *
+ *  Same as @ref cy_JSON_parser_ctx_parse_segments, with the parser context shared by the whole application.
+ *
+ * @param[in] segments      : Array of segments of JSON data, in order
+ * @param[in] segment_count : Number of segments
+ *
+ * @return cy_rslt_t
+ */
+cy_rslt_t cy_JSON_parser_segments( const cy_JSON_segment_t* segments, uint32_t segment_count );
+
+/** Check that the input is one well-formed JSON document, without parsing it.
+ *
+ *  Checks the structure of the document, the string escapes, the UTF-8 encoding of strings and the grammar of the numbers
+ *  as specified by RFC 8259. No callback is invoked and no value is converted, so the input is only read once, at close to
+ *  memory speed. The document may be any JSON value, surrounded by whitespace.
+ *
+ *  UTF-8 sequences which are overlong, encode a surrogate or exceed U+10FFFF are rejected. \uXXXX escapes only need to
+ *  have four hexadecimal digits; unpaired surrogates in escapes are accepted, as by RFC 8259.
+ *
+ * @param[in]  json_input   : Pointer to the JSON document, which must be complete
+ * @param[in]  input_length : Length of the JSON document pointed by `json_input`
+ * @param[out] error_offset : Optional; set to the offset of the first byte in error, or to `input_length` when the
+ *                            document is truncated. Unchanged on success.
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the input ends before the JSON document
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than CY_JSON_VALIDATE_MAX_DEPTH
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_validate( const char* json_input, uint32_t input_length, uint32_t* error_offset );
+
+/** Get the value referenced by a JSON pointer, without parsing the whole JSON document
+ *
+ *  The JSON pointer is evaluated as specified by RFC 6901, for instance "/state/desired/led" or "/items/0/id", "" being
+ *  the whole document. The document is only read up to the end of the value. The members and elements before the
+ *  value are skipped by counting quotes and brackets, so they are not checked and no callback is invoked.
+ *
+ *  Member names are compared with their escape sequences decoded. When an object has several members with the same
+ *  name, the first one is used.
+ *
+ * @param[in]  json_input     : Pointer to the JSON document
+ * @param[in]  input_length   : Length of the JSON document pointed by `json_input`
+ * @param[in]  pointer        : JSON pointer, in its string representation
+ * @param[in]  pointer_length : Length of the JSON pointer
+ * @param[out] type           : JSON data type of the value. Numbers are JSON_NUMBER_TYPE or JSON_FLOAT_TYPE
+ * @param[out] value          : Pointer to the value in the JSON document. Strings are returned without their quotes, and with
+ *                              their escape sequences; objects and arrays from their '{' or '[' to their '}' or ']'
+ * @param[out] value_length   : Length of the value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the JSON document has no value at this pointer
+ *                    - CY_RSLT_JSON_INCOMPLETE if the input ends before the value
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed
+ *                    - CY_RSLT_JSON_BADARG, also if the JSON pointer is malformed
+ */
+cy_rslt_t cy_JSON_get_pointer( const char* json_input, uint32_t input_length, const char* pointer, uint32_t pointer_length,
+                               cy_JSON_type_t* type, const char** value, uint32_t* value_length );
+
+/** Decode the escape sequences of a JSON string
+ *
+ * All the escape sequences of RFC 8259 are decoded. \uXXXX escapes are encoded in UTF-8, with surrogate pairs combined
+ * into one character; unpaired surrogates are decoded as U+FFFD. The decoded string is never longer than the escaped
+ * one, so it can be decoded in place by passing the same buffer as `input` and `output`. Strings without escape
+ * sequences are copied at memcpy speed.
+ *
+ * @param[in]  input         : String, as it appears between the quotes in a JSON document
+ * @param[in]  input_length  : Length of the string
+ * @param[out] output        : Buffer receiving the decoded string, which is not NUL terminated. May be `input`
+ * @param[in]  output_size   : Size of the output buffer
+ * @param[out] output_length : Set to the length of the decoded string
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the decoded string does not fit in the output buffer
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if an escape sequence is malformed
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_unescape( const char* input, uint32_t input_length, char* output, uint32_t output_size, uint32_t* output_length );
+
 /** @} */
 
 #ifdef __cplusplus
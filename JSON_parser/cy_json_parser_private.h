@@ -0,0 +1,131 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * Interface between the JSON parser and the other modules of the JSON parser utility library.
+ *
+ * The tape index and the other representations built on top of the parser install an event handler on a
+ * parser context. The event handler replaces the application callback: it receives every value, and the start
+ * and the end of every object and array. Values and member names point into the input buffer, unless they were
+ * split across input buffers.
+ *
+ * This interface is internal to the JSON parser utility library and is not part of its API.
+ */
+#pragma once
+
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* Returned by the event handler on CY_JSON_EVENT_CONTAINER_START to skip the contents of the object or array.
+ * No event is reported for the contents, nor for the end of the object or array.
+ */
+#define CY_JSON_EVENT_RSLT_SKIP        CY_RSLT_JSON_SKIP
+
+/* Returned by cy_json_parser_resume when the event handler paused the parse */
+#define CY_JSON_EVENT_RSLT_PAUSED      CY_RSLT_CREATE( CY_RSLT_TYPE_INFO, CY_RSLT_MODULE_JSON_BASE, 2 )
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/* Events passed to the event handler */
+typedef enum
+{
+    CY_JSON_EVENT_VALUE = 0,           /* String, number, boolean or null. The member name is in ctx->key and the full length of the value in ctx->value_length */
+    CY_JSON_EVENT_CONTAINER_START,     /* Object or array start. value points to the '{' or '[' */
+    CY_JSON_EVENT_CONTAINER_END        /* Object or array end. value points to the '}' or ']' */
+} cy_json_event_t;
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Function Declarations
+ ******************************************************/
+
+/* Set the int64val, uint64val, doubleval, intval and floatval fields of a number reported to the event handler,
+ * and its value_type to JSON_NUMBER_TYPE or JSON_FLOAT_TYPE. Only valid during the CY_JSON_EVENT_VALUE event.
+ */
+void cy_json_parser_convert_number( cy_JSON_parser_ctx_t* ctx, cy_JSON_object_t* json_object );
+
+/* Parse the JSON number starting at position, outside of a parser context, and set the fields of json_object as
+ * cy_json_parser_convert_number does, except doubleval and floatval with CY_JSON_FIXED_POINT. Returns the end of the
+ * number, or end if the number may continue past it, or NULL if position does not start a well-formed number.
+ */
+const char* cy_json_parser_scan_number( const char* position, const char* end, cy_JSON_number_t* number, cy_JSON_object_t* json_object );
+
+#ifdef CY_JSON_FIXED_POINT
+/* Set the doubleval and floatval fields of a number parsed by cy_json_parser_scan_number. Numbers which the fast path
+ * cannot convert exactly are converted with big integers, and floating-point operations: only call this function for
+ * floating-point destinations.
+ */
+void cy_json_parser_number_floating( const cy_JSON_number_t* number, cy_JSON_object_t* json_object );
+#endif
+
+/* Install an event handler on a parser context, or remove it if handler is NULL */
+void cy_json_parser_set_event_handler( cy_JSON_parser_ctx_t* ctx, cy_JSON_event_handler_t handler, void* arg );
+
+/* Called by the event handler to stop the parse once the current event has been processed. cy_json_parser_resume then
+ * returns CY_JSON_EVENT_RSLT_PAUSED, and parsing continues with the rest of the input buffer on the next call.
+ */
+void cy_json_parser_pause( cy_JSON_parser_ctx_t* ctx );
+
+/* Same as cy_JSON_parser_ctx_parse, but returns CY_JSON_EVENT_RSLT_PAUSED when the event handler pauses the parse.
+ * consumed is set to the number of bytes of json_input parsed, which is input_length unless the parse was paused.
+ */
+cy_rslt_t cy_json_parser_resume( cy_JSON_parser_ctx_t* ctx, const char* json_input, uint32_t input_length, uint32_t* consumed );
+
+/* Skip the rest of the innermost open object or array, while the parse is paused. No event is reported for its contents,
+ * nor for its end.
+ */
+void cy_json_parser_skip_container( cy_JSON_parser_ctx_t* ctx );
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
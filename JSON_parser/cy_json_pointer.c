@@ -0,0 +1,602 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include <string.h>
+#include "cy_json_parser.h"
+#include "cy_json_scan.h"
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+#define JSON_POINTER_IS_DIGIT( ch )       ( ( (ch) >= '0' ) && ( (ch) <= '9' ) )
+
+#define JSON_POINTER_IS_DELIMITER( ch )   ( ( (ch) == COMMA_SEPARATOR ) || ( (ch) == OBJECT_END_TOKEN ) || ( (ch) == ARRAY_END_TOKEN ) || \
+                                            ( (ch) == ' ' ) || ( (ch) == '\t' ) || ( (ch) == '\r' ) || ( (ch) == '\n' ) )
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/* Skips a string, position being at the opening quote. On return, position is after the closing quote */
+static cy_rslt_t json_pointer_skip_string( const char** position, const char* end )
+{
+    const char* current = *position + 1;
+
+    while ( true )
+    {
+        current = cy_json_scan_string( current, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current == STRING_TOKEN )
+        {
+            *position = current + 1;
+            return CY_RSLT_SUCCESS;
+        }
+        if ( *current != ESCAPE_TOKEN )
+        {
+            /* Control character */
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        if ( end - current < 2 )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        current += 2;
+    }
+}
+
+/* Skips an object or an array by counting brackets, without checking what is inside. On return, position is after its end */
+static cy_rslt_t json_pointer_skip_container( const char** position, const char* end )
+{
+    const char* current = *position;
+    uint32_t    depth   = 0;
+    cy_rslt_t   result;
+
+    while ( true )
+    {
+        current = cy_json_scan_skip( current, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+
+        switch ( *current )
+        {
+            case STRING_TOKEN:
+                result = json_pointer_skip_string( &current, end );
+                if ( result != CY_RSLT_SUCCESS )
+                {
+                    return result;
+                }
+                continue;
+
+            case OBJECT_START_TOKEN:
+            case ARRAY_START_TOKEN:
+                depth++;
+                break;
+
+            default:
+                depth--;
+                break;
+        }
+
+        current++;
+        if ( depth == 0 )
+        {
+            *position = current;
+            return CY_RSLT_SUCCESS;
+        }
+    }
+}
+
+/* Skips a value, position being at its first character. On return, position is after the value */
+static cy_rslt_t json_pointer_skip_value( const char** position, const char* end )
+{
+    const char* current = *position;
+
+    switch ( *current )
+    {
+        case STRING_TOKEN:
+            return json_pointer_skip_string( position, end );
+
+        case OBJECT_START_TOKEN:
+        case ARRAY_START_TOKEN:
+            return json_pointer_skip_container( position, end );
+
+        default:
+            /* Number, true, false or null */
+            while ( ( current < end ) && !JSON_POINTER_IS_DELIMITER( *current ) )
+            {
+                current++;
+            }
+            if ( current == *position )
+            {
+                return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+            *position = current;
+            return CY_RSLT_SUCCESS;
+    }
+}
+
+/* Compares a reference token of a JSON pointer, with ~0 and ~1 sequences, with a member name, with escape sequences */
+static bool json_pointer_match( const char* token, const char* token_end, const char* name, const char* name_end )
+{
+    const char* escape_end;
+    char        decoded[ 8 ];
+    char        character;
+    uint32_t    length;
+    uint32_t    i;
+
+    while ( name < name_end )
+    {
+        if ( *name != ESCAPE_TOKEN )
+        {
+            decoded[ 0 ] = *name++;
+            length       = 1;
+        }
+        else
+        {
+            /* Decode one escape sequence, or a surrogate pair */
+            escape_end = name + 2;
+            if ( name[ 1 ] == 'u' )
+            {
+                escape_end = name + 6;
+                if ( ( name_end - name >= 12 ) && ( ( name[ 2 ] == 'd' ) || ( name[ 2 ] == 'D' ) ) &&
+                     ( ( name[ 3 ] == '8' ) || ( name[ 3 ] == '9' ) || ( ( name[ 3 ] | 0x20 ) == 'a' ) || ( ( name[ 3 ] | 0x20 ) == 'b' ) ) &&
+                     ( name[ 6 ] == ESCAPE_TOKEN ) && ( name[ 7 ] == 'u' ) )
+                {
+                    escape_end = name + 12;
+                }
+            }
+            if ( ( escape_end > name_end ) ||
+                 ( cy_JSON_unescape( name, (uint32_t)( escape_end - name ), decoded, sizeof( decoded ), &length ) != CY_RSLT_SUCCESS ) )
+            {
+                return false;
+            }
+            name = escape_end;
+        }
+
+        for ( i = 0; i < length; i++ )
+        {
+            if ( token == token_end )
+            {
+                return false;
+            }
+            character = *token++;
+            if ( character == '~' )
+            {
+                character = ( *token++ == '0' ) ? '~' : '/';
+            }
+            if ( character != decoded[ i ] )
+            {
+                return false;
+            }
+        }
+    }
+
+    return ( token == token_end );
+}
+
+/* Finds the member named by a reference token, position being at the '{' of the object. On return, position is at its value */
+static cy_rslt_t json_pointer_member( const char** position, const char* end, const char* token, const char* token_end )
+{
+    const char* current = cy_json_scan_whitespace( *position + 1, end );
+    const char* name;
+    cy_rslt_t   result;
+    bool        found;
+
+    if ( ( current < end ) && ( *current == OBJECT_END_TOKEN ) )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    while ( true )
+    {
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current != STRING_TOKEN )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+
+        name   = current + 1;
+        result = json_pointer_skip_string( &current, end );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        found = json_pointer_match( token, token_end, name, current - 1 );
+
+        current = cy_json_scan_whitespace( current, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current != START_OF_VALUE )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current = cy_json_scan_whitespace( current + 1, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+
+        if ( found )
+        {
+            *position = current;
+            return CY_RSLT_SUCCESS;
+        }
+
+        /* Other members are skipped without being parsed */
+        result = json_pointer_skip_value( &current, end );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        current = cy_json_scan_whitespace( current, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current == OBJECT_END_TOKEN )
+        {
+            return CY_RSLT_JSON_NOT_FOUND;
+        }
+        if ( *current != COMMA_SEPARATOR )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current = cy_json_scan_whitespace( current + 1, end );
+    }
+}
+
+/* Finds the element indexed by a reference token, position being at the '[' of the array. On return, position is at the element */
+static cy_rslt_t json_pointer_element( const char** position, const char* end, const char* token, const char* token_end )
+{
+    const char* current = cy_json_scan_whitespace( *position + 1, end );
+    uint32_t    index   = 0;
+    cy_rslt_t   result;
+
+    /* Indexes are decimal, without leading zeros. "-", past the last element, is never found */
+    if ( ( token == token_end ) || ( ( *token == '0' ) && ( token_end - token > 1 ) ) )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+    while ( token < token_end )
+    {
+        if ( !JSON_POINTER_IS_DIGIT( *token ) || ( index > ( UINT32_MAX - 9 ) / 10 ) )
+        {
+            return CY_RSLT_JSON_NOT_FOUND;
+        }
+        index = ( index * 10 ) + (uint32_t)( *token++ - '0' );
+    }
+
+    if ( ( current < end ) && ( *current == ARRAY_END_TOKEN ) )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    while ( true )
+    {
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( index == 0 )
+        {
+            *position = current;
+            return CY_RSLT_SUCCESS;
+        }
+
+        /* Preceding elements are skipped without being parsed */
+        result = json_pointer_skip_value( &current, end );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        current = cy_json_scan_whitespace( current, end );
+        if ( current == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current == ARRAY_END_TOKEN )
+        {
+            return CY_RSLT_JSON_NOT_FOUND;
+        }
+        if ( *current != COMMA_SEPARATOR )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current = cy_json_scan_whitespace( current + 1, end );
+        index--;
+    }
+}
+
+/* Skips the digits at position, of which there must be at least one */
+static cy_rslt_t json_pointer_digits( const char** position, const char* end )
+{
+    const char* current = *position;
+
+    while ( ( current < end ) && JSON_POINTER_IS_DIGIT( *current ) )
+    {
+        current++;
+    }
+    if ( current == *position )
+    {
+        return ( current == end ) ? CY_RSLT_JSON_INCOMPLETE : CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    *position = current;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Checks a number and tells integers from numbers with a fraction or an exponent, without converting it.
+ * On return, position is after the number
+ */
+static cy_rslt_t json_pointer_number( const char** position, const char* end, cy_JSON_type_t* type )
+{
+    const char* current = *position;
+    cy_rslt_t   result;
+
+    if ( *current == '-' )
+    {
+        current++;
+    }
+
+    /* Integer part: 0, or digits not starting with 0 */
+    if ( ( current < end ) && ( *current == '0' ) )
+    {
+        current++;
+    }
+    else if ( ( result = json_pointer_digits( &current, end ) ) != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    *type = JSON_NUMBER_TYPE;
+
+    if ( ( current < end ) && ( *current == '.' ) )
+    {
+        current++;
+        if ( ( result = json_pointer_digits( &current, end ) ) != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        *type = JSON_FLOAT_TYPE;
+    }
+
+    if ( ( current < end ) && ( ( *current == 'e' ) || ( *current == 'E' ) ) )
+    {
+        current++;
+        if ( ( current < end ) && ( ( *current == '+' ) || ( *current == '-' ) ) )
+        {
+            current++;
+        }
+        if ( ( result = json_pointer_digits( &current, end ) ) != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+        *type = JSON_FLOAT_TYPE;
+    }
+
+    *position = current;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Gets the type and the extent of the value at position, which is the root of the JSON document or is in an object or array */
+static cy_rslt_t json_pointer_value( const char* position, const char* end, bool root, cy_JSON_type_t* type, const char** value, uint32_t* value_length )
+{
+    const char*       current = position;
+    const char*       literal;
+    cy_rslt_t         result;
+
+    switch ( *position )
+    {
+        case STRING_TOKEN:
+            result = json_pointer_skip_string( &current, end );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            /* Strings are returned without their quotes */
+            *type         = JSON_STRING_TYPE;
+            *value        = position + 1;
+            *value_length = (uint32_t)( current - position - 2 );
+            return CY_RSLT_SUCCESS;
+
+        case OBJECT_START_TOKEN:
+        case ARRAY_START_TOKEN:
+            result = json_pointer_skip_container( &current, end );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            *type         = ( *position == OBJECT_START_TOKEN ) ? JSON_OBJECT_TYPE : JSON_ARRAY_TYPE;
+            *value        = position;
+            *value_length = (uint32_t)( current - position );
+            return CY_RSLT_SUCCESS;
+
+        case TRUE_TOKEN:
+        case FALSE_TOKEN:
+        case NULL_TOKEN:
+            literal = ( *position == TRUE_TOKEN ) ? "true" : ( ( *position == FALSE_TOKEN ) ? "false" : "null" );
+            while ( *literal != '\0' )
+            {
+                if ( current == end )
+                {
+                    return CY_RSLT_JSON_INCOMPLETE;
+                }
+                if ( *current++ != *literal++ )
+                {
+                    return CY_RSLT_JSON_GENERIC_ERROR;
+                }
+            }
+            *type = ( *position == NULL_TOKEN ) ? JSON_NULL_TYPE : JSON_BOOLEAN_TYPE;
+            break;
+
+        default:
+            result = json_pointer_number( &current, end, type );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+            break;
+    }
+
+    /* Inside an object or array, a number or literal ending with the input may continue in the missing part of it */
+    if ( current == end )
+    {
+        if ( !root )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+    }
+    else if ( !JSON_POINTER_IS_DELIMITER( *current ) )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    *value        = position;
+    *value_length = (uint32_t)( current - position );
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_get_pointer( const char* json_input, uint32_t input_length, const char* pointer, uint32_t pointer_length,
+                               cy_JSON_type_t* type, const char** value, uint32_t* value_length )
+{
+    const char* end         = json_input + input_length;
+    const char* pointer_end = pointer + pointer_length;
+    const char* position;
+    const char* token;
+    const char* token_end;
+    cy_rslt_t   result;
+
+    if ( ( ( json_input == NULL ) && ( input_length != 0 ) ) || ( ( pointer == NULL ) && ( pointer_length != 0 ) ) ||
+         ( type == NULL ) || ( value == NULL ) || ( value_length == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* A pointer is empty, for the whole document, or a sequence of '/' followed by a reference token, where '~' only
+     * appears in ~0 and ~1
+     */
+    if ( ( pointer_length != 0 ) && ( *pointer != '/' ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    for ( token = pointer; token < pointer_end; token++ )
+    {
+        if ( ( *token == '~' ) && ( ( token + 1 == pointer_end ) || ( ( token[ 1 ] != '0' ) && ( token[ 1 ] != '1' ) ) ) )
+        {
+            return CY_RSLT_JSON_BADARG;
+        }
+    }
+
+    position = cy_json_scan_whitespace( json_input, end );
+    token    = pointer;
+
+    while ( token < pointer_end )
+    {
+        token++;
+        token_end = memchr( token, '/', (size_t)( pointer_end - token ) );
+        if ( token_end == NULL )
+        {
+            token_end = pointer_end;
+        }
+
+        if ( position == end )
+        {
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *position == OBJECT_START_TOKEN )
+        {
+            result = json_pointer_member( &position, end, token, token_end );
+        }
+        else if ( *position == ARRAY_START_TOKEN )
+        {
+            result = json_pointer_element( &position, end, token, token_end );
+        }
+        else
+        {
+            /* Strings, numbers, true, false and null have nothing to refer to */
+            result = CY_RSLT_JSON_NOT_FOUND;
+        }
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+
+        token = token_end;
+    }
+
+    if ( position == end )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    return json_pointer_value( position, end, ( pointer_length == 0 ), type, value, value_length );
+}
@@ -0,0 +1,533 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ * Vectorized scanning helpers used by the JSON parser utility library
+ */
+#include "cy_json_scan.h"
+#include <string.h>
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+#if !defined( CY_JSON_SCAN_DISABLE_SIMD ) && defined( __AVX2__ )
+#define JSON_SCAN_AVX2
+#include <immintrin.h>
+#elif !defined( CY_JSON_SCAN_DISABLE_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) ) )
+#define JSON_SCAN_SSE2
+#include <emmintrin.h>
+#elif !defined( CY_JSON_SCAN_DISABLE_SIMD ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+#define JSON_SCAN_NEON
+#include <arm_neon.h>
+#else
+#define JSON_SCAN_SWAR
+#endif
+
+/* Number of bytes classified per step */
+#if defined( JSON_SCAN_AVX2 )
+#define JSON_SCAN_WIDTH                 (32)
+#elif defined( JSON_SCAN_SWAR )
+#define JSON_SCAN_WIDTH                 (8)
+#else
+#define JSON_SCAN_WIDTH                 (16)
+#endif
+
+#define JSON_SCAN_IS_WHITESPACE( ch )   ( ( ( ch ) == ' ' ) || ( ( ch ) == '\t' ) || ( ( ch ) == '\n' ) || ( ( ch ) == '\r' ) )
+
+#define JSON_SCAN_IS_STRING_SPECIAL( ch ) ( ( ( ch ) == '"' ) || ( ( ch ) == '\\' ) || ( (uint8_t)( ch ) < 0x20 ) )
+
+#define JSON_SCAN_IS_STRING_ASCII_SPECIAL( ch ) ( ( ( ch ) == '"' ) || ( ( ch ) == '\\' ) || ( (uint8_t)( ch ) < 0x20 ) || ( (uint8_t)( ch ) >= 0x80 ) )
+
+/* Setting bit 5 maps '[' to '{' and ']' to '}', and no other character to either */
+#define JSON_SCAN_IS_SKIP_SPECIAL( ch ) ( ( ( ch ) == '"' ) || ( ( ( ch ) | 0x20 ) == '{' ) || ( ( ( ch ) | 0x20 ) == '}' ) )
+
+#if defined( JSON_SCAN_SWAR )
+#define JSON_SWAR_ONES                  (0x0101010101010101ULL)
+#define JSON_SWAR_HIGH_BITS             (0x8080808080808080ULL)
+#define JSON_SWAR_LOW_BITS              (0x7F7F7F7F7F7F7F7FULL)
+
+/* Sets the high bit of every byte of word equal to ch. Exact, no false positives from borrows */
+#define JSON_SWAR_EQ( word, ch )        json_swar_zero_bytes( ( word ) ^ ( JSON_SWAR_ONES * (uint8_t)( ch ) ) )
+#endif
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+#if defined( JSON_SCAN_AVX2 ) || defined( JSON_SCAN_SSE2 )
+
+static inline uint32_t json_scan_first( uint32_t mask )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return (uint32_t)__builtin_ctz( mask );
+#else
+    uint32_t offset = 0;
+
+    while ( ( mask & 1 ) == 0 )
+    {
+        mask >>= 1;
+        offset++;
+    }
+    return offset;
+#endif
+}
+
+#endif
+
+#if defined( JSON_SCAN_AVX2 )
+
+/* Offset of the first '"', '\' or control character in the next 32 bytes, or 32 */
+static inline uint32_t json_scan_string_step( const char* position )
+{
+    __m256i  input = _mm256_loadu_si256( (const __m256i*)position );
+    __m256i  match = _mm256_or_si256( _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '"' ) ), _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\\' ) ) );
+    uint32_t mask;
+
+    /* Unsigned input <= 0x1F */
+    match = _mm256_or_si256( match, _mm256_cmpeq_epi8( _mm256_max_epu8( input, _mm256_set1_epi8( 0x1F ) ), _mm256_set1_epi8( 0x1F ) ) );
+    mask  = (uint32_t)_mm256_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first '"', '\', control or non-ASCII character in the next 32 bytes, or 32 */
+static inline uint32_t json_scan_string_ascii_step( const char* position )
+{
+    __m256i  input = _mm256_loadu_si256( (const __m256i*)position );
+    __m256i  match = _mm256_or_si256( _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '"' ) ), _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\\' ) ) );
+    uint32_t mask;
+
+    /* As signed bytes, both control characters and non-ASCII bytes are below 0x20 */
+    match = _mm256_or_si256( match, _mm256_cmpgt_epi8( _mm256_set1_epi8( 0x20 ), input ) );
+    mask  = (uint32_t)_mm256_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first character which is not whitespace in the next 32 bytes, or 32 */
+static inline uint32_t json_scan_whitespace_step( const char* position )
+{
+    __m256i  input = _mm256_loadu_si256( (const __m256i*)position );
+    __m256i  match = _mm256_or_si256( _mm256_cmpeq_epi8( input, _mm256_set1_epi8( ' ' ) ), _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\t' ) ) );
+    uint32_t mask;
+
+    match = _mm256_or_si256( match, _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\n' ) ) );
+    match = _mm256_or_si256( match, _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\r' ) ) );
+    mask  = ~(uint32_t)_mm256_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first '"', '{', '}', '[' or ']' in the next 32 bytes, or 32 */
+static inline uint32_t json_scan_skip_step( const char* position )
+{
+    __m256i  input = _mm256_loadu_si256( (const __m256i*)position );
+    __m256i  lower = _mm256_or_si256( input, _mm256_set1_epi8( 0x20 ) );
+    __m256i  match = _mm256_or_si256( _mm256_cmpeq_epi8( lower, _mm256_set1_epi8( '{' ) ), _mm256_cmpeq_epi8( lower, _mm256_set1_epi8( '}' ) ) );
+    uint32_t mask;
+
+    match = _mm256_or_si256( match, _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '"' ) ) );
+    mask  = (uint32_t)_mm256_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+#elif defined( JSON_SCAN_SSE2 )
+
+/* Offset of the first '"', '\' or control character in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_string_step( const char* position )
+{
+    __m128i  input = _mm_loadu_si128( (const __m128i*)position );
+    __m128i  match = _mm_or_si128( _mm_cmpeq_epi8( input, _mm_set1_epi8( '"' ) ), _mm_cmpeq_epi8( input, _mm_set1_epi8( '\\' ) ) );
+    uint32_t mask;
+
+    /* Unsigned input <= 0x1F */
+    match = _mm_or_si128( match, _mm_cmpeq_epi8( _mm_max_epu8( input, _mm_set1_epi8( 0x1F ) ), _mm_set1_epi8( 0x1F ) ) );
+    mask  = (uint32_t)_mm_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first '"', '\', control or non-ASCII character in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_string_ascii_step( const char* position )
+{
+    __m128i  input = _mm_loadu_si128( (const __m128i*)position );
+    __m128i  match = _mm_or_si128( _mm_cmpeq_epi8( input, _mm_set1_epi8( '"' ) ), _mm_cmpeq_epi8( input, _mm_set1_epi8( '\\' ) ) );
+    uint32_t mask;
+
+    /* As signed bytes, both control characters and non-ASCII bytes are below 0x20 */
+    match = _mm_or_si128( match, _mm_cmplt_epi8( input, _mm_set1_epi8( 0x20 ) ) );
+    mask  = (uint32_t)_mm_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first character which is not whitespace in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_whitespace_step( const char* position )
+{
+    __m128i  input = _mm_loadu_si128( (const __m128i*)position );
+    __m128i  match = _mm_or_si128( _mm_cmpeq_epi8( input, _mm_set1_epi8( ' ' ) ), _mm_cmpeq_epi8( input, _mm_set1_epi8( '\t' ) ) );
+    uint32_t mask;
+
+    match = _mm_or_si128( match, _mm_cmpeq_epi8( input, _mm_set1_epi8( '\n' ) ) );
+    match = _mm_or_si128( match, _mm_cmpeq_epi8( input, _mm_set1_epi8( '\r' ) ) );
+    mask  = ( ~(uint32_t)_mm_movemask_epi8( match ) ) & 0xFFFF;
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+/* Offset of the first '"', '{', '}', '[' or ']' in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_skip_step( const char* position )
+{
+    __m128i  input = _mm_loadu_si128( (const __m128i*)position );
+    __m128i  lower = _mm_or_si128( input, _mm_set1_epi8( 0x20 ) );
+    __m128i  match = _mm_or_si128( _mm_cmpeq_epi8( lower, _mm_set1_epi8( '{' ) ), _mm_cmpeq_epi8( lower, _mm_set1_epi8( '}' ) ) );
+    uint32_t mask;
+
+    match = _mm_or_si128( match, _mm_cmpeq_epi8( input, _mm_set1_epi8( '"' ) ) );
+    mask  = (uint32_t)_mm_movemask_epi8( match );
+
+    return ( mask ) ? json_scan_first( mask ) : JSON_SCAN_WIDTH;
+}
+
+#elif defined( JSON_SCAN_NEON )
+
+/* Offset of the first non-zero byte of a comparison result, or 16. Narrowing to 4 bits per byte
+ * replaces the movemask instruction NEON does not have.
+ */
+static inline uint32_t json_scan_neon_first( uint8x16_t match )
+{
+    uint64_t mask = vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( match ), 4 ) ), 0 );
+    uint32_t offset = 0;
+
+    if ( mask == 0 )
+    {
+        return JSON_SCAN_WIDTH;
+    }
+#if defined( __GNUC__ ) || defined( __clang__ )
+    offset = (uint32_t)__builtin_ctzll( mask ) >> 2;
+#else
+    while ( ( mask & 0xF ) == 0 )
+    {
+        mask >>= 4;
+        offset++;
+    }
+#endif
+    return offset;
+}
+
+/* Offset of the first '"', '\' or control character in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_string_step( const char* position )
+{
+    uint8x16_t input = vld1q_u8( (const uint8_t*)position );
+    uint8x16_t match = vorrq_u8( vceqq_u8( input, vdupq_n_u8( '"' ) ), vceqq_u8( input, vdupq_n_u8( '\\' ) ) );
+
+    match = vorrq_u8( match, vcltq_u8( input, vdupq_n_u8( 0x20 ) ) );
+
+    return json_scan_neon_first( match );
+}
+
+/* Offset of the first '"', '\', control or non-ASCII character in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_string_ascii_step( const char* position )
+{
+    uint8x16_t input = vld1q_u8( (const uint8_t*)position );
+    uint8x16_t match = vorrq_u8( vceqq_u8( input, vdupq_n_u8( '"' ) ), vceqq_u8( input, vdupq_n_u8( '\\' ) ) );
+
+    match = vorrq_u8( match, vcltq_u8( input, vdupq_n_u8( 0x20 ) ) );
+    match = vorrq_u8( match, vcgeq_u8( input, vdupq_n_u8( 0x80 ) ) );
+
+    return json_scan_neon_first( match );
+}
+
+/* Offset of the first character which is not whitespace in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_whitespace_step( const char* position )
+{
+    uint8x16_t input = vld1q_u8( (const uint8_t*)position );
+    uint8x16_t match = vorrq_u8( vceqq_u8( input, vdupq_n_u8( ' ' ) ), vceqq_u8( input, vdupq_n_u8( '\t' ) ) );
+
+    match = vorrq_u8( match, vceqq_u8( input, vdupq_n_u8( '\n' ) ) );
+    match = vorrq_u8( match, vceqq_u8( input, vdupq_n_u8( '\r' ) ) );
+
+    return json_scan_neon_first( vmvnq_u8( match ) );
+}
+
+/* Offset of the first '"', '{', '}', '[' or ']' in the next 16 bytes, or 16 */
+static inline uint32_t json_scan_skip_step( const char* position )
+{
+    uint8x16_t input = vld1q_u8( (const uint8_t*)position );
+    uint8x16_t lower = vorrq_u8( input, vdupq_n_u8( 0x20 ) );
+    uint8x16_t match = vorrq_u8( vceqq_u8( lower, vdupq_n_u8( '{' ) ), vceqq_u8( lower, vdupq_n_u8( '}' ) ) );
+
+    match = vorrq_u8( match, vceqq_u8( input, vdupq_n_u8( '"' ) ) );
+
+    return json_scan_neon_first( match );
+}
+
+#else /* JSON_SCAN_SWAR */
+
+/* Sets the high bit of every zero byte of word */
+static inline uint64_t json_swar_zero_bytes( uint64_t word )
+{
+    return ~( ( ( word & JSON_SWAR_LOW_BITS ) + JSON_SWAR_LOW_BITS ) | word | JSON_SWAR_LOW_BITS );
+}
+
+static inline uint64_t json_swar_load( const char* position )
+{
+    uint64_t word;
+
+    memcpy( &word, position, sizeof( word ) );
+    return word;
+}
+
+/* Offset of the first byte of word with its high bit set, or 8 */
+static inline uint32_t json_swar_first( uint64_t mask )
+{
+    uint32_t offset = 0;
+
+    if ( mask == 0 )
+    {
+        return JSON_SCAN_WIDTH;
+    }
+#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+    while ( ( mask & 0x8000000000000000ULL ) == 0 )
+    {
+        mask <<= 8;
+        offset++;
+    }
+#else
+    while ( ( mask & 0x80 ) == 0 )
+    {
+        mask >>= 8;
+        offset++;
+    }
+#endif
+    return offset;
+}
+
+/* Offset of the first '"', '\' or control character in the next 8 bytes, or 8 */
+static inline uint32_t json_scan_string_step( const char* position )
+{
+    uint64_t word = json_swar_load( position );
+
+    /* A byte below 0x20 has its three upper bits clear */
+    return json_swar_first( JSON_SWAR_EQ( word, '"' ) | JSON_SWAR_EQ( word, '\\' ) | json_swar_zero_bytes( word & 0xE0E0E0E0E0E0E0E0ULL ) );
+}
+
+/* Offset of the first '"', '\', control or non-ASCII character in the next 8 bytes, or 8 */
+static inline uint32_t json_scan_string_ascii_step( const char* position )
+{
+    uint64_t word = json_swar_load( position );
+
+    return json_swar_first( JSON_SWAR_EQ( word, '"' ) | JSON_SWAR_EQ( word, '\\' ) | json_swar_zero_bytes( word & 0xE0E0E0E0E0E0E0E0ULL ) | ( word & JSON_SWAR_HIGH_BITS ) );
+}
+
+/* Offset of the first character which is not whitespace in the next 8 bytes, or 8 */
+static inline uint32_t json_scan_whitespace_step( const char* position )
+{
+    uint64_t word = json_swar_load( position );
+    uint64_t match = JSON_SWAR_EQ( word, ' ' ) | JSON_SWAR_EQ( word, '\t' ) | JSON_SWAR_EQ( word, '\n' ) | JSON_SWAR_EQ( word, '\r' );
+
+    return json_swar_first( match ^ JSON_SWAR_HIGH_BITS );
+}
+
+/* Offset of the first '"', '{', '}', '[' or ']' in the next 8 bytes, or 8 */
+static inline uint32_t json_scan_skip_step( const char* position )
+{
+    uint64_t word  = json_swar_load( position );
+    uint64_t lower = word | ( JSON_SWAR_ONES * 0x20 );
+
+    return json_swar_first( JSON_SWAR_EQ( word, '"' ) | JSON_SWAR_EQ( lower, '{' ) | JSON_SWAR_EQ( lower, '}' ) );
+}
+
+#endif
+
+
+const char* cy_json_scan_string( const char* position, const char* end )
+{
+    uint32_t offset;
+
+    while ( ( end - position ) >= JSON_SCAN_WIDTH )
+    {
+        offset = json_scan_string_step( position );
+        if ( offset < JSON_SCAN_WIDTH )
+        {
+            return position + offset;
+        }
+        position += JSON_SCAN_WIDTH;
+    }
+
+    while ( ( position < end ) && !JSON_SCAN_IS_STRING_SPECIAL( *position ) )
+    {
+        position++;
+    }
+
+    return position;
+}
+
+
+const char* cy_json_scan_string_ascii( const char* position, const char* end )
+{
+    uint32_t offset;
+
+    while ( ( end - position ) >= JSON_SCAN_WIDTH )
+    {
+        offset = json_scan_string_ascii_step( position );
+        if ( offset < JSON_SCAN_WIDTH )
+        {
+            return position + offset;
+        }
+        position += JSON_SCAN_WIDTH;
+    }
+
+    while ( ( position < end ) && !JSON_SCAN_IS_STRING_ASCII_SPECIAL( *position ) )
+    {
+        position++;
+    }
+
+    return position;
+}
+
+
+const char* cy_json_scan_whitespace( const char* position, const char* end )
+{
+    uint32_t offset;
+
+    /* Most JSON is compact. Do not classify a whole block when there is no whitespace to skip */
+    if ( ( position < end ) && !JSON_SCAN_IS_WHITESPACE( *position ) )
+    {
+        return position;
+    }
+
+    while ( ( end - position ) >= JSON_SCAN_WIDTH )
+    {
+        offset = json_scan_whitespace_step( position );
+        if ( offset < JSON_SCAN_WIDTH )
+        {
+            return position + offset;
+        }
+        position += JSON_SCAN_WIDTH;
+    }
+
+    while ( ( position < end ) && JSON_SCAN_IS_WHITESPACE( *position ) )
+    {
+        position++;
+    }
+
+    return position;
+}
+
+
+const char* cy_json_scan_skip( const char* position, const char* end )
+{
+    uint32_t offset;
+
+    while ( ( end - position ) >= JSON_SCAN_WIDTH )
+    {
+        offset = json_scan_skip_step( position );
+        if ( offset < JSON_SCAN_WIDTH )
+        {
+            return position + offset;
+        }
+        position += JSON_SCAN_WIDTH;
+    }
+
+    while ( ( position < end ) && !JSON_SCAN_IS_SKIP_SPECIAL( *position ) )
+    {
+        position++;
+    }
+
+    return position;
+}
+
+
+bool cy_json_scan_eight_digits( const char* position, uint32_t* value )
+{
+#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+    uint32_t i;
+
+    *value = 0;
+    for ( i = 0; i < 8; i++ )
+    {
+        if ( ( position[ i ] < '0' ) || ( position[ i ] > '9' ) )
+        {
+            return false;
+        }
+        *value = ( *value * 10 ) + (uint32_t)( position[ i ] - '0' );
+    }
+
+    return true;
+#else
+    uint64_t word;
+
+    memcpy( &word, position, sizeof( word ) );
+
+    /* Every byte is a digit when its upper nibble is 3, and stays 3 once 6 is added to its lower nibble */
+    if ( ( ( word & 0xF0F0F0F0F0F0F0F0ULL ) | ( ( ( word + 0x0606060606060606ULL ) & 0xF0F0F0F0F0F0F0F0ULL ) >> 4 ) ) != 0x3333333333333333ULL )
+    {
+        return false;
+    }
+
+    /* Combine the digits in pairs, then in groups of 4, then 8. The first digit is in the lowest byte */
+    word   = ( ( word & 0x0F0F0F0F0F0F0F0FULL ) * 2561 ) >> 8;
+    word   = ( ( word & 0x00FF00FF00FF00FFULL ) * 6553601 ) >> 16;
+    *value = (uint32_t)( ( ( word & 0x0000FFFF0000FFFFULL ) * 42949672960001ULL ) >> 32 );
+
+    return true;
+#endif
+}
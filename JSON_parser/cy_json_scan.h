@@ -0,0 +1,93 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * Vectorized scanning helpers used by the JSON parser utility library.
+ *
+ * These helpers classify 8 to 32 input bytes per step, using AVX2 or SSE2 on x86 hosts, NEON on Cortex-A
+ * and a portable SWAR (SIMD within a register) implementation elsewhere, for instance on Cortex-M.
+ * Define CY_JSON_SCAN_DISABLE_SIMD to always use the SWAR implementation.
+ *
+ * The helpers are internal to the JSON parser utility library and are not part of its API.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Function Declarations
+ ******************************************************/
+
+/* Returns the first '"', '\' or control character found between position and end, or end if there is none */
+const char* cy_json_scan_string( const char* position, const char* end );
+
+/* Returns the first '"', '\', control or non-ASCII character found between position and end, or end if there is none */
+const char* cy_json_scan_string_ascii( const char* position, const char* end );
+
+/* Returns the first character which is not JSON whitespace found between position and end, or end if there is none */
+const char* cy_json_scan_whitespace( const char* position, const char* end );
+
+/* Returns the first '"', '{', '}', '[' or ']' found between position and end, or end if there is none */
+const char* cy_json_scan_skip( const char* position, const char* end );
+
+/* Returns true if the 8 bytes at position are all decimal digits, and sets value to the number they make */
+bool cy_json_scan_eight_digits( const char* position, uint32_t* value );
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
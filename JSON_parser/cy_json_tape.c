@@ -0,0 +1,340 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_tape.h"
+#include "cy_json_parser_private.h"
+#include <stddef.h>
+#include <string.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* No object or array open */
+#define JSON_TAPE_NONE                 (0xFFFFFFFFUL)
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/* State of the tape while it is built */
+typedef struct
+{
+    cy_JSON_tape_t*     tape;
+    uint32_t            open;           /* Innermost object or array still open */
+    bool                full;           /* Set when the tape entries are exhausted */
+} json_tape_builder_t;
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/* Append the parse events to the tape. While an object or array is open, the next field of its entry
+ * links to the enclosing open container; it is set to its final value when the container ends.
+ */
+static cy_rslt_t json_tape_event( struct cy_JSON_parser_ctx* ctx, uint8_t event, cy_JSON_object_t* json_object, void* arg )
+{
+    json_tape_builder_t*  builder = (json_tape_builder_t*)arg;
+    cy_JSON_tape_t*       tape    = builder->tape;
+    cy_JSON_tape_entry_t* entry;
+
+    /* The input holds a single JSON document: another one must not follow the root */
+    if ( ( tape->count != 0 ) && ( builder->open == JSON_TAPE_NONE ) )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    if ( event == CY_JSON_EVENT_CONTAINER_END )
+    {
+        entry         = &tape->entries[ builder->open ];
+        builder->open = entry->next;
+        entry->next   = tape->count;
+        return CY_RSLT_SUCCESS;
+    }
+
+    if ( ( tape->count + ( ( ctx->key != NULL ) ? 2 : 1 ) ) > tape->max_entries )
+    {
+        builder->full = true;
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+
+    if ( builder->open != JSON_TAPE_NONE )
+    {
+        tape->entries[ builder->open ].length++;
+    }
+
+    if ( ctx->key != NULL )
+    {
+        entry = &tape->entries[ tape->count++ ];
+
+        entry->offset = (uint32_t)( ctx->key - tape->json_input );
+        entry->length = ctx->key_length;
+        entry->next   = tape->count;
+        entry->type   = JSON_STRING_TYPE;
+        entry->is_key = true;
+    }
+
+    entry = &tape->entries[ tape->count ];
+
+    entry->offset = (uint32_t)( json_object->value - tape->json_input );
+    entry->type   = (uint8_t)json_object->value_type;
+    entry->is_key = false;
+
+    if ( event == CY_JSON_EVENT_CONTAINER_START )
+    {
+        entry->length = 0;
+        entry->next   = builder->open;
+        builder->open = tape->count;
+    }
+    else
+    {
+        entry->length = ctx->value_length;
+        entry->next   = tape->count + 1;
+    }
+    tape->count++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+static bool json_tape_is_container( const cy_JSON_tape_t* tape, uint32_t index )
+{
+    return ( ( tape != NULL ) && ( index < tape->count ) && !tape->entries[ index ].is_key &&
+             ( ( tape->entries[ index ].type == JSON_OBJECT_TYPE ) || ( tape->entries[ index ].type == JSON_ARRAY_TYPE ) ) );
+}
+
+
+cy_rslt_t cy_JSON_tape_build( cy_JSON_tape_t* tape, cy_JSON_tape_entry_t* entries, uint32_t max_entries, const char* json_input, uint32_t input_length )
+{
+    cy_JSON_parser_ctx_t ctx;
+    json_tape_builder_t  builder;
+    cy_rslt_t            result;
+
+    if ( ( tape == NULL ) || ( ( entries == NULL ) && ( max_entries != 0 ) ) || ( json_input == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    tape->json_input  = json_input;
+    tape->entries     = entries;
+    tape->max_entries = max_entries;
+    tape->count       = 0;
+
+    builder.tape = tape;
+    builder.open = JSON_TAPE_NONE;
+    builder.full = false;
+
+    /* The whole document is in json_input: the context does not need a token buffer */
+    cy_JSON_parser_ctx_init( &ctx );
+    cy_json_parser_set_event_handler( &ctx, json_tape_event, &builder );
+
+    result = cy_JSON_parser_ctx_parse( &ctx, json_input, input_length );
+
+    if ( builder.full )
+    {
+        result = CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+    else if ( ( ( result == CY_RSLT_SUCCESS ) && ( tape->count == 0 ) ) || ( result == CY_RSLT_JSON_BUFFER_OVERFLOW ) )
+    {
+        /* Nothing was parsed, or the input ends in the middle of a token the context has no token buffer to keep */
+        result = CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        tape->count = 0;
+    }
+
+    return result;
+}
+
+
+cy_rslt_t cy_JSON_tape_get_value( const cy_JSON_tape_t* tape, uint32_t index, cy_JSON_type_t* type, const char** value, uint32_t* length )
+{
+    const cy_JSON_tape_entry_t* entry;
+
+    if ( ( tape == NULL ) || ( index >= tape->count ) || ( type == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    entry = &tape->entries[ index ];
+    *type = (cy_JSON_type_t)entry->type;
+
+    if ( value != NULL )
+    {
+        *value = tape->json_input + entry->offset;
+    }
+    if ( length != NULL )
+    {
+        *length = entry->length;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_tape_get_key( const cy_JSON_tape_t* tape, uint32_t index, const char** key, uint32_t* length )
+{
+    const cy_JSON_tape_entry_t* entry;
+
+    if ( ( tape == NULL ) || ( index >= tape->count ) || ( key == NULL ) || ( length == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* The member name immediately precedes the value */
+    if ( ( index == 0 ) || tape->entries[ index ].is_key || !tape->entries[ index - 1 ].is_key )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    entry   = &tape->entries[ index - 1 ];
+    *key    = tape->json_input + entry->offset;
+    *length = entry->length;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_tape_get_member( const cy_JSON_tape_t* tape, uint32_t object, const char* key, uint32_t key_length, uint32_t* index )
+{
+    const cy_JSON_tape_entry_t* entry;
+    uint32_t                    i;
+
+    if ( !json_tape_is_container( tape, object ) || ( tape->entries[ object ].type != JSON_OBJECT_TYPE ) ||
+         ( ( key == NULL ) && ( key_length != 0 ) ) || ( index == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* Members are (name, value) entry pairs; the value's next field skips its descendants */
+    for ( i = object + 1; i < tape->entries[ object ].next; i = tape->entries[ i + 1 ].next )
+    {
+        entry = &tape->entries[ i ];
+        if ( ( entry->length == key_length ) && ( memcmp( tape->json_input + entry->offset, key, key_length ) == 0 ) )
+        {
+            *index = i + 1;
+            return CY_RSLT_SUCCESS;
+        }
+    }
+
+    return CY_RSLT_JSON_NOT_FOUND;
+}
+
+
+cy_rslt_t cy_JSON_tape_get_element( const cy_JSON_tape_t* tape, uint32_t array, uint32_t position, uint32_t* index )
+{
+    uint32_t i;
+
+    if ( !json_tape_is_container( tape, array ) || ( tape->entries[ array ].type != JSON_ARRAY_TYPE ) || ( index == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( position >= tape->entries[ array ].length )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    for ( i = array + 1; position > 0; position-- )
+    {
+        i = tape->entries[ i ].next;
+    }
+
+    *index = i;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_tape_first_child( const cy_JSON_tape_t* tape, uint32_t container, uint32_t* index )
+{
+    if ( !json_tape_is_container( tape, container ) || ( index == NULL ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    if ( tape->entries[ container ].length == 0 )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    /* Skip the name of the first member */
+    *index = ( tape->entries[ container ].type == JSON_OBJECT_TYPE ) ? ( container + 2 ) : ( container + 1 );
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_tape_next_child( const cy_JSON_tape_t* tape, uint32_t container, uint32_t* index )
+{
+    uint32_t next;
+
+    if ( !json_tape_is_container( tape, container ) || ( index == NULL ) || ( *index <= container ) || ( *index >= tape->entries[ container ].next ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    next = tape->entries[ *index ].next;
+    if ( next >= tape->entries[ container ].next )
+    {
+        return CY_RSLT_JSON_NOT_FOUND;
+    }
+
+    /* Skip the name of the next member */
+    *index = ( tape->entries[ container ].type == JSON_OBJECT_TYPE ) ? ( next + 1 ) : next;
+
+    return CY_RSLT_SUCCESS;
+}
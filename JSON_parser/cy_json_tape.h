@@ -0,0 +1,228 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+/**
+ * @file
+ * The JSON tape utility builds an index of a JSON document held in memory, and answers random access queries on it.
+ *
+ * The tape is an array of entries filled in a single pass of the JSON parser, one entry per value and one entry per member
+ * name, in document order. Entries do not copy any data: they refer to the JSON document through offsets. Each object and
+ * array entry records the index of the entry following its last descendant, so whole sub-trees are skipped in one step when
+ * looking up a member or an element.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+/** Index of the root value of the JSON document in the tape */
+#define CY_JSON_TAPE_ROOT             (0)
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+/** JSON tape entry
+ *
+ * Member names of an object are stored as JSON_STRING_TYPE entries, each immediately followed by the entry of its value.
+ */
+typedef struct
+{
+    uint32_t            offset;     /**< Offset of the value in the JSON document. For strings, offset of the first character after the opening quote */
+    uint32_t            length;     /**< Length in bytes of a string, number or literal. Number of members or elements of an object or array */
+    uint32_t            next;       /**< Index of the entry following this value and all its descendants */
+    uint8_t             type;       /**< @ref cy_JSON_type_t of the value: JSON_STRING_TYPE, JSON_NUMBER_TYPE, JSON_BOOLEAN_TYPE, JSON_NULL_TYPE, JSON_OBJECT_TYPE or JSON_ARRAY_TYPE */
+    bool                is_key;     /**< Set for the member names of objects */
+} cy_JSON_tape_entry_t;
+
+/** JSON tape */
+typedef struct
+{
+    const char*             json_input;     /**< JSON document indexed by the tape */
+    cy_JSON_tape_entry_t*   entries;        /**< Tape entries, provided by the application */
+    uint32_t                max_entries;    /**< Number of entries available */
+    uint32_t                count;          /**< Number of entries used */
+} cy_JSON_tape_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Build the tape of a JSON document
+ *
+ * The JSON document must be complete in `json_input`, which must remain valid and unchanged while the tape is in use.
+ * The tape needs one entry per value and one entry per member name. Strings and member names are indexed as they
+ * appear in the JSON document: escape sequences are not decoded.
+ *
+ * Besides the tape entries, building the tape takes the sizeof( cy_JSON_parser_ctx_t ) bytes of a parser context on the
+ * stack of the caller, about 1 KB with the default CY_JSON_MAX_DEPTH of 8.
+ *
+ * @param[out] tape         : Pointer to the tape to be built
+ * @param[in]  entries      : Array of tape entries
+ * @param[in]  max_entries  : Number of entries in the `entries` array
+ * @param[in]  json_input   : Pointer to the JSON document
+ * @param[in]  input_length : Length of the JSON document
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BUFFER_OVERFLOW if the JSON document has more than `max_entries` entries
+ *                    - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than CY_JSON_MAX_DEPTH
+ *                    - CY_RSLT_JSON_INCOMPLETE if the JSON document is truncated
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if the JSON document is malformed, or followed by another one
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_tape_build( cy_JSON_tape_t* tape, cy_JSON_tape_entry_t* entries, uint32_t max_entries, const char* json_input, uint32_t input_length );
+
+/** Get the type and the value of a tape entry
+ *
+ * @param[in]  tape   : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]  index  : Index of the entry
+ * @param[out] type   : JSON data type of the entry
+ * @param[out] value  : Pointer to the value in the JSON document. For objects and arrays, pointer to the '{' or '['. May be NULL
+ * @param[out] length : Length of the value, or number of members or elements of an object or array. May be NULL
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_tape_get_value( const cy_JSON_tape_t* tape, uint32_t index, cy_JSON_type_t* type, const char** value, uint32_t* length );
+
+/** Get the member name of an object member
+ *
+ * @param[in]  tape   : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]  index  : Index of the value of the member
+ * @param[out] key    : Pointer to the member name in the JSON document
+ * @param[out] length : Length of the member name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the value is not an object member
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_tape_get_key( const cy_JSON_tape_t* tape, uint32_t index, const char** key, uint32_t* length );
+
+/** Look up an object member by name
+ *
+ * Members are compared with the member name as it appears in the JSON document. The cost is proportional to the
+ * number of members of the object; the descendants of the other members are skipped.
+ *
+ * @param[in]  tape       : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]  object     : Index of the object
+ * @param[in]  key        : Member name
+ * @param[in]  key_length : Length of the member name
+ * @param[out] index      : Index of the value of the first member with this name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the object has no such member
+ *                    - CY_RSLT_JSON_BADARG if `object` is not an object
+ */
+cy_rslt_t cy_JSON_tape_get_member( const cy_JSON_tape_t* tape, uint32_t object, const char* key, uint32_t key_length, uint32_t* index );
+
+/** Look up an array element by position
+ *
+ * The cost is proportional to `position`; the descendants of the preceding elements are skipped.
+ *
+ * @param[in]  tape     : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]  array    : Index of the array
+ * @param[in]  position : Position of the element in the array, starting from 0
+ * @param[out] index    : Index of the element
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the array has fewer elements
+ *                    - CY_RSLT_JSON_BADARG if `array` is not an array
+ */
+cy_rslt_t cy_JSON_tape_get_element( const cy_JSON_tape_t* tape, uint32_t array, uint32_t position, uint32_t* index );
+
+/** Get the first member or element of an object or array
+ *
+ * @param[in]  tape      : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]  container : Index of the object or array
+ * @param[out] index     : Index of the value of the first member, or of the first element
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if the object or array is empty
+ *                    - CY_RSLT_JSON_BADARG if `container` is not an object or an array
+ */
+cy_rslt_t cy_JSON_tape_first_child( const cy_JSON_tape_t* tape, uint32_t container, uint32_t* index );
+
+/** Get the next member or element of an object or array
+ *
+ * @param[in]     tape      : Pointer to a tape built by @ref cy_JSON_tape_build
+ * @param[in]     container : Index of the object or array
+ * @param[in,out] index     : Index of the value of a member, or of an element. Updated with the index of the next one
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_NOT_FOUND if there is no next member or element
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_tape_next_child( const cy_JSON_tape_t* tape, uint32_t container, uint32_t* index );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
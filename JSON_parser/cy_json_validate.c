@@ -0,0 +1,483 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_parser.h"
+#include "cy_json_scan.h"
+#include <stddef.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+#define JSON_VALIDATE_IS_DIGIT( ch )   ( ( (ch) >= '0' ) && ( (ch) <= '9' ) )
+
+#define JSON_VALIDATE_IS_HEX( ch )     ( JSON_VALIDATE_IS_DIGIT( ch ) || ( ( (ch) >= 'a' ) && ( (ch) <= 'f' ) ) || ( ( (ch) >= 'A' ) && ( (ch) <= 'F' ) ) )
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/* What the validator expects next, apart from whitespace */
+typedef enum
+{
+    JSON_VALIDATE_VALUE,            /* Any value */
+    JSON_VALIDATE_MEMBER,           /* Name of an object member, followed by ':' */
+    JSON_VALIDATE_FIRST,            /* First member or element of a container, or its end */
+    JSON_VALIDATE_AFTER_VALUE       /* ',' or the end of the container */
+} json_validate_state_t;
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+static const char* json_validate_digits( const char* position, const char* end )
+{
+    while ( ( position < end ) && JSON_VALIDATE_IS_DIGIT( *position ) )
+    {
+        position++;
+    }
+    return position;
+}
+
+/* Checks a number. On return, position is after the number, or at the character in error */
+static cy_rslt_t json_validate_number( const char** position, const char* end )
+{
+    const char* current = *position;
+
+    if ( *current == '-' )
+    {
+        current++;
+    }
+
+    /* Integer part: 0, or digits not starting with 0 */
+    if ( current == end )
+    {
+        *position = current;
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+    if ( *current == '0' )
+    {
+        current++;
+    }
+    else if ( JSON_VALIDATE_IS_DIGIT( *current ) )
+    {
+        current = json_validate_digits( current + 1, end );
+    }
+    else
+    {
+        *position = current;
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    /* Fraction and exponent both need at least one digit */
+    if ( ( current < end ) && ( *current == '.' ) )
+    {
+        current++;
+        if ( ( current == end ) || !JSON_VALIDATE_IS_DIGIT( *current ) )
+        {
+            *position = current;
+            return ( current == end ) ? CY_RSLT_JSON_INCOMPLETE : CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current = json_validate_digits( current + 1, end );
+    }
+
+    if ( ( current < end ) && ( ( *current == 'e' ) || ( *current == 'E' ) ) )
+    {
+        current++;
+        if ( ( current < end ) && ( ( *current == '+' ) || ( *current == '-' ) ) )
+        {
+            current++;
+        }
+        if ( ( current == end ) || !JSON_VALIDATE_IS_DIGIT( *current ) )
+        {
+            *position = current;
+            return ( current == end ) ? CY_RSLT_JSON_INCOMPLETE : CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current = json_validate_digits( current + 1, end );
+    }
+
+    *position = current;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Checks one of true, false or null */
+static cy_rslt_t json_validate_literal( const char** position, const char* end, const char* literal )
+{
+    const char* current = *position;
+
+    while ( *literal != '\0' )
+    {
+        if ( current == end )
+        {
+            *position = current;
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( *current != *literal )
+        {
+            *position = current;
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        current++;
+        literal++;
+    }
+
+    *position = current;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Checks one UTF-8 sequence starting with a byte of 0x80 or more. Overlong sequences, surrogates and code points
+ * above U+10FFFF are rejected, following the table of well-formed byte sequences of the Unicode standard */
+static cy_rslt_t json_validate_utf8( const char** position, const char* end )
+{
+    const uint8_t* current = (const uint8_t*)*position;
+    uint8_t        lead    = *current;
+    uint8_t        low     = 0x80;
+    uint8_t        high    = 0xBF;
+    uint32_t       count;
+
+    if ( ( lead >= 0xC2 ) && ( lead <= 0xDF ) )
+    {
+        count = 1;
+    }
+    else if ( ( lead >= 0xE0 ) && ( lead <= 0xEF ) )
+    {
+        count = 2;
+        if ( lead == 0xE0 )
+        {
+            low = 0xA0;
+        }
+        else if ( lead == 0xED )
+        {
+            high = 0x9F;
+        }
+    }
+    else if ( ( lead >= 0xF0 ) && ( lead <= 0xF4 ) )
+    {
+        count = 3;
+        if ( lead == 0xF0 )
+        {
+            low = 0x90;
+        }
+        else if ( lead == 0xF4 )
+        {
+            high = 0x8F;
+        }
+    }
+    else
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    current++;
+    while ( count-- > 0 )
+    {
+        if ( current == (const uint8_t*)end )
+        {
+            *position = end;
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+        if ( ( *current < low ) || ( *current > high ) )
+        {
+            *position = (const char*)current;
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        low  = 0x80;
+        high = 0xBF;
+        current++;
+    }
+
+    *position = (const char*)current;
+    return CY_RSLT_SUCCESS;
+}
+
+/* Checks a string, position being after the opening quote. On return, position is after the closing quote */
+static cy_rslt_t json_validate_string( const char** position, const char* end )
+{
+    const char* current = *position;
+    cy_rslt_t   result;
+    uint32_t    index;
+
+    while ( true )
+    {
+        /* Plain ASCII characters are skipped many at a time */
+        current = cy_json_scan_string_ascii( current, end );
+        if ( current == end )
+        {
+            *position = current;
+            return CY_RSLT_JSON_INCOMPLETE;
+        }
+
+        if ( *current == '"' )
+        {
+            *position = current + 1;
+            return CY_RSLT_SUCCESS;
+        }
+        else if ( *current == '\\' )
+        {
+            current++;
+            if ( current == end )
+            {
+                *position = current;
+                return CY_RSLT_JSON_INCOMPLETE;
+            }
+            switch ( *current )
+            {
+                case '"':
+                case '\\':
+                case '/':
+                case 'b':
+                case 'f':
+                case 'n':
+                case 'r':
+                case 't':
+                    current++;
+                    break;
+
+                case 'u':
+                    current++;
+                    for ( index = 0; index < 4; index++, current++ )
+                    {
+                        if ( ( current == end ) || !JSON_VALIDATE_IS_HEX( *current ) )
+                        {
+                            *position = current;
+                            return ( current == end ) ? CY_RSLT_JSON_INCOMPLETE : CY_RSLT_JSON_GENERIC_ERROR;
+                        }
+                    }
+                    break;
+
+                default:
+                    *position = current;
+                    return CY_RSLT_JSON_GENERIC_ERROR;
+            }
+        }
+        else if ( (uint8_t)*current < 0x20 )
+        {
+            /* Control characters must be escaped */
+            *position = current;
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+        else
+        {
+            result = json_validate_utf8( &current, end );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                *position = current;
+                return result;
+            }
+        }
+    }
+}
+
+
+cy_rslt_t cy_JSON_validate( const char* json_input, uint32_t input_length, uint32_t* error_offset )
+{
+    /* One bit per nesting level, set for objects and clear for arrays */
+    uint8_t               containers[ ( CY_JSON_VALIDATE_MAX_DEPTH + 7 ) / 8 ];
+    uint32_t              depth    = 0;
+    bool                  in_object = false;
+    json_validate_state_t state    = JSON_VALIDATE_VALUE;
+    cy_rslt_t             result   = CY_RSLT_SUCCESS;
+    const char*           position;
+    const char*           end;
+
+    if ( json_input == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    position = json_input;
+    end      = json_input + input_length;
+
+    while ( result == CY_RSLT_SUCCESS )
+    {
+        /* Compact documents have no whitespace between tokens */
+        if ( ( position == end ) || ( (uint8_t)*position <= ' ' ) )
+        {
+            position = cy_json_scan_whitespace( position, end );
+        }
+        if ( position == end )
+        {
+            if ( ( state != JSON_VALIDATE_AFTER_VALUE ) || ( depth != 0 ) )
+            {
+                result = CY_RSLT_JSON_INCOMPLETE;
+            }
+            break;
+        }
+
+        switch ( state )
+        {
+            case JSON_VALIDATE_FIRST:
+                if ( *position == ( in_object ? OBJECT_END_TOKEN : ARRAY_END_TOKEN ) )
+                {
+                    state = JSON_VALIDATE_AFTER_VALUE;
+                    break;
+                }
+                state = in_object ? JSON_VALIDATE_MEMBER : JSON_VALIDATE_VALUE;
+                continue;
+
+            case JSON_VALIDATE_MEMBER:
+                if ( *position != STRING_TOKEN )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    continue;
+                }
+                position++;
+                result = json_validate_string( &position, end );
+                if ( result != CY_RSLT_SUCCESS )
+                {
+                    continue;
+                }
+                position = cy_json_scan_whitespace( position, end );
+                if ( position == end )
+                {
+                    result = CY_RSLT_JSON_INCOMPLETE;
+                }
+                else if ( *position != START_OF_VALUE )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                }
+                else
+                {
+                    position++;
+                    state = JSON_VALIDATE_VALUE;
+                }
+                continue;
+
+            case JSON_VALIDATE_VALUE:
+                state = JSON_VALIDATE_AFTER_VALUE;
+                switch ( *position )
+                {
+                    case OBJECT_START_TOKEN:
+                    case ARRAY_START_TOKEN:
+                        if ( depth == CY_JSON_VALIDATE_MAX_DEPTH )
+                        {
+                            result = CY_RSLT_JSON_DEPTH_EXCEEDED;
+                            continue;
+                        }
+                        in_object = ( *position == OBJECT_START_TOKEN );
+                        if ( in_object )
+                        {
+                            containers[ depth / 8 ] |= (uint8_t)( 1u << ( depth % 8 ) );
+                        }
+                        else
+                        {
+                            containers[ depth / 8 ] &= (uint8_t)~( 1u << ( depth % 8 ) );
+                        }
+                        depth++;
+                        position++;
+                        state = JSON_VALIDATE_FIRST;
+                        continue;
+
+                    case STRING_TOKEN:
+                        position++;
+                        result = json_validate_string( &position, end );
+                        continue;
+
+                    case 't':
+                        result = json_validate_literal( &position, end, "true" );
+                        continue;
+
+                    case 'f':
+                        result = json_validate_literal( &position, end, "false" );
+                        continue;
+
+                    case 'n':
+                        result = json_validate_literal( &position, end, "null" );
+                        continue;
+
+                    default:
+                        if ( ( *position == '-' ) || JSON_VALIDATE_IS_DIGIT( *position ) )
+                        {
+                            result = json_validate_number( &position, end );
+                        }
+                        else
+                        {
+                            result = CY_RSLT_JSON_GENERIC_ERROR;
+                        }
+                        continue;
+                }
+
+            case JSON_VALIDATE_AFTER_VALUE:
+            default:
+                if ( ( depth != 0 ) && ( *position == ',' ) )
+                {
+                    position++;
+                    state = in_object ? JSON_VALIDATE_MEMBER : JSON_VALIDATE_VALUE;
+                    continue;
+                }
+                if ( ( depth == 0 ) || ( *position != ( in_object ? OBJECT_END_TOKEN : ARRAY_END_TOKEN ) ) )
+                {
+                    result = CY_RSLT_JSON_GENERIC_ERROR;
+                    continue;
+                }
+                break;
+        }
+
+        /* End of the innermost container: the one around it becomes current */
+        position++;
+        depth--;
+        if ( depth != 0 )
+        {
+            in_object = ( ( containers[ ( depth - 1 ) / 8 ] & ( 1u << ( ( depth - 1 ) % 8 ) ) ) != 0 );
+        }
+    }
+
+    if ( ( result != CY_RSLT_SUCCESS ) && ( error_offset != NULL ) )
+    {
+        *error_offset = (uint32_t)( position - json_input );
+    }
+
+    return result;
+}
@@ -0,0 +1,752 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/** @file
+ *
+ */
+#include "cy_json_writer.h"
+#include "cy_json_scan.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+#define JSON_WRITER_IS_OBJECT( writer )    ( ( (writer)->containers[ ( (writer)->depth - 1 ) / 8 ] & ( 1U << ( ( (writer)->depth - 1 ) % 8 ) ) ) != 0 )
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/* Longest number written: 20 digits and a sign, or a double with 17 significant digits, its sign, point and exponent */
+#define JSON_WRITER_NUMBER_SIZE            (32)
+
+/* Fewest and most significant digits tried to write a double which parses back to the same value */
+#define JSON_WRITER_DOUBLE_MIN_DIGITS      (15)
+#define JSON_WRITER_DOUBLE_MAX_DIGITS      (17)
+
+/* Largest power of ten, and first integer, which are not all exact doubles */
+#define JSON_WRITER_MAX_EXACT_POWER        (22)
+#define JSON_WRITER_MAX_EXACT_INTEGER      (9007199254740992.0)
+
+/* Doubles with more zeros than this after the decimal point are written with an exponent */
+#define JSON_WRITER_MAX_LEADING_ZEROS      (5)
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/******************************************************
+ *               Static Function Declarations
+ ******************************************************/
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+
+static const char json_hex_digits[] = "0123456789abcdef";
+
+static const double json_writer_powers_of_ten[ JSON_WRITER_MAX_EXACT_POWER + 1 ] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/******************************************************
+ *               Function Definitions
+ ******************************************************/
+
+/* Pass the contents of the buffer to the flush callback, and reuse the buffer */
+static cy_rslt_t json_writer_flush( cy_JSON_writer_t* writer )
+{
+    cy_rslt_t result;
+
+    if ( writer->flush == NULL )
+    {
+        return CY_RSLT_JSON_BUFFER_OVERFLOW;
+    }
+    if ( writer->used == 0 )
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    result       = writer->flush( writer->buffer, writer->used, writer->argument );
+    writer->used = 0;
+
+    return result;
+}
+
+/* Append data to the buffer, flushing it each time it is full */
+static cy_rslt_t json_writer_put( cy_JSON_writer_t* writer, const char* data, uint32_t length )
+{
+    cy_rslt_t result;
+    uint32_t  part;
+
+    while ( length > 0 )
+    {
+        if ( writer->used == writer->size )
+        {
+            result = json_writer_flush( writer );
+            if ( result != CY_RSLT_SUCCESS )
+            {
+                return result;
+            }
+        }
+
+        part = writer->size - writer->used;
+        part = ( length < part ) ? length : part;
+        memcpy( writer->buffer + writer->used, data, part );
+        writer->used  += part;
+        writer->total += part;
+        data          += part;
+        length        -= part;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t json_writer_put_char( cy_JSON_writer_t* writer, char ch )
+{
+    cy_rslt_t result;
+
+    if ( writer->used == writer->size )
+    {
+        result = json_writer_flush( writer );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return result;
+        }
+    }
+
+    writer->buffer[ writer->used++ ] = ch;
+    writer->total++;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/* Write the contents of a string, escaping quotes, backslashes and control characters. Runs of other characters are copied as they are */
+static cy_rslt_t json_writer_put_escaped( cy_JSON_writer_t* writer, const char* string, uint32_t length )
+{
+    cy_rslt_t   result = CY_RSLT_SUCCESS;
+    const char* end    = string + length;
+    const char* run;
+    char        escape[ 6 ] = { '\\', 'u', '0', '0', 0, 0 };
+    uint32_t    escape_length;
+
+    while ( ( result == CY_RSLT_SUCCESS ) && ( string < end ) )
+    {
+        run    = cy_json_scan_string( string, end );
+        result = json_writer_put( writer, string, (uint32_t)( run - string ) );
+        if ( ( result != CY_RSLT_SUCCESS ) || ( run == end ) )
+        {
+            break;
+        }
+
+        escape_length = 2;
+        switch ( *run )
+        {
+            case '"':
+            case '\\':
+                escape[ 1 ] = *run;
+                break;
+            case '\b':
+                escape[ 1 ] = 'b';
+                break;
+            case '\f':
+                escape[ 1 ] = 'f';
+                break;
+            case '\n':
+                escape[ 1 ] = 'n';
+                break;
+            case '\r':
+                escape[ 1 ] = 'r';
+                break;
+            case '\t':
+                escape[ 1 ] = 't';
+                break;
+            default:
+                escape[ 1 ]   = 'u';
+                escape[ 4 ]   = json_hex_digits[ ( (uint8_t)*run ) >> 4 ];
+                escape[ 5 ]   = json_hex_digits[ ( (uint8_t)*run ) & 0x0F ];
+                escape_length = 6;
+                break;
+        }
+
+        result = json_writer_put( writer, escape, escape_length );
+        string = run + 1;
+    }
+
+    return result;
+}
+
+/* Write the digits of a double which is the integer mantissa divided by 10^decimals, as for "%g", without snprintf().
+ * Returns the length written at number.
+ */
+static uint32_t json_writer_decimal( char* number, bool negative, uint64_t mantissa, uint32_t decimals )
+{
+    char     digits[ JSON_WRITER_NUMBER_SIZE ];
+    char*    digit    = digits + sizeof( digits );
+    char*    position = number;
+    uint32_t count;
+    int32_t  exponent;
+    uint32_t i;
+
+    do
+    {
+        *--digit  = (char)( '0' + ( mantissa % 10 ) );
+        mantissa /= 10;
+    } while ( mantissa != 0 );
+    count    = (uint32_t)( digits + sizeof( digits ) - digit );
+    exponent = (int32_t)count - 1 - (int32_t)decimals;
+
+    if ( negative )
+    {
+        *position++ = '-';
+    }
+
+    if ( exponent < -JSON_WRITER_MAX_LEADING_ZEROS )
+    {
+        /* d.ddde-x */
+        *position++ = *digit++;
+        if ( count > 1 )
+        {
+            *position++ = '.';
+            memcpy( position, digit, count - 1 );
+            position += count - 1;
+        }
+        *position++ = 'e';
+        *position++ = '-';
+        exponent    = -exponent;
+        if ( exponent >= 10 )
+        {
+            *position++ = (char)( '0' + ( exponent / 10 ) );
+        }
+        *position++ = (char)( '0' + ( exponent % 10 ) );
+    }
+    else if ( count > decimals )
+    {
+        /* ddd.ddd */
+        memcpy( position, digit, count - decimals );
+        position += count - decimals;
+        if ( decimals != 0 )
+        {
+            *position++ = '.';
+            memcpy( position, digit + count - decimals, decimals );
+            position += decimals;
+        }
+    }
+    else
+    {
+        /* 0.000ddd */
+        *position++ = '0';
+        *position++ = '.';
+        for ( i = count; i < decimals; i++ )
+        {
+            *position++ = '0';
+        }
+        memcpy( position, digit, count );
+        position += count;
+    }
+
+    return (uint32_t)( position - number );
+}
+
+/* snprintf() writes the decimal point of the current locale, which must be a '.' in JSON */
+static uint32_t json_writer_decimal_point( char* number, uint32_t length )
+{
+    uint32_t i;
+    uint32_t j = 0;
+    bool     point = false;
+
+    for ( i = 0; i < length; i++ )
+    {
+        if ( ( ( number[ i ] >= '0' ) && ( number[ i ] <= '9' ) ) || ( number[ i ] == '-' ) || ( number[ i ] == '+' ) || ( number[ i ] == 'e' ) )
+        {
+            number[ j++ ] = number[ i ];
+            point         = false;
+        }
+        else if ( !point )
+        {
+            /* The decimal point may be several bytes long */
+            number[ j++ ] = '.';
+            point         = true;
+        }
+    }
+
+    return j;
+}
+
+/* Write a string between quotes */
+static cy_rslt_t json_writer_put_string( cy_JSON_writer_t* writer, const char* string, uint32_t length )
+{
+    cy_rslt_t result = json_writer_put_char( writer, '"' );
+
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_escaped( writer, string, length );
+    }
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return result;
+    }
+
+    return json_writer_put_char( writer, '"' );
+}
+
+/* Check that a value may be written here, and write the comma separating it from the previous element */
+static cy_rslt_t json_writer_value_start( cy_JSON_writer_t* writer )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ( writer->in_string )
+    {
+        return CY_RSLT_JSON_GENERIC_ERROR;
+    }
+
+    if ( writer->depth == 0 )
+    {
+        /* A single value is the document root */
+        if ( !writer->first )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+    }
+    else if ( JSON_WRITER_IS_OBJECT( writer ) )
+    {
+        if ( !writer->after_key )
+        {
+            return CY_RSLT_JSON_GENERIC_ERROR;
+        }
+    }
+    else if ( !writer->first )
+    {
+        result = json_writer_put_char( writer, ',' );
+    }
+
+    writer->first     = false;
+    writer->after_key = false;
+
+    return result;
+}
+
+/* Keep the first error met by the writer */
+static cy_rslt_t json_writer_result( cy_JSON_writer_t* writer, cy_rslt_t result )
+{
+    writer->result = result;
+
+    return result;
+}
+
+/* Write a value which needs no escaping */
+static cy_rslt_t json_writer_value( cy_JSON_writer_t* writer, const char* value, uint32_t length )
+{
+    cy_rslt_t result;
+
+    if ( writer == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+
+    result = json_writer_value_start( writer );
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put( writer, value, length );
+    }
+
+    return json_writer_result( writer, result );
+}
+
+static cy_rslt_t json_writer_container_start( cy_JSON_writer_t* writer, bool object )
+{
+    cy_rslt_t result;
+
+    if ( writer == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+    if ( writer->depth >= CY_JSON_WRITER_MAX_DEPTH )
+    {
+        return json_writer_result( writer, CY_RSLT_JSON_DEPTH_EXCEEDED );
+    }
+
+    result = json_writer_value_start( writer );
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_char( writer, ( object ) ? '{' : '[' );
+    }
+    if ( result != CY_RSLT_SUCCESS )
+    {
+        return json_writer_result( writer, result );
+    }
+
+    if ( object )
+    {
+        writer->containers[ writer->depth / 8 ] |= (uint8_t)( 1U << ( writer->depth % 8 ) );
+    }
+    else
+    {
+        writer->containers[ writer->depth / 8 ] &= (uint8_t)~( 1U << ( writer->depth % 8 ) );
+    }
+    writer->depth++;
+    writer->first = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+static cy_rslt_t json_writer_container_end( cy_JSON_writer_t* writer, bool object )
+{
+    if ( writer == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+    if ( ( writer->depth == 0 ) || ( JSON_WRITER_IS_OBJECT( writer ) != object ) || writer->after_key || writer->in_string )
+    {
+        return json_writer_result( writer, CY_RSLT_JSON_GENERIC_ERROR );
+    }
+
+    writer->depth--;
+    writer->first = false;
+
+    return json_writer_result( writer, json_writer_put_char( writer, ( object ) ? '}' : ']' ) );
+}
+
+
+cy_rslt_t cy_JSON_writer_init( cy_JSON_writer_t* writer, char* buffer, uint32_t size, cy_JSON_writer_flush_t flush, void* arg )
+{
+    if ( ( writer == NULL ) || ( buffer == NULL ) || ( size == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    memset( writer, 0x0, sizeof( *writer ) );
+    writer->buffer   = buffer;
+    writer->size     = size;
+    writer->flush    = flush;
+    writer->argument = arg;
+    writer->result   = CY_RSLT_SUCCESS;
+    writer->first    = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+
+cy_rslt_t cy_JSON_writer_begin_object( cy_JSON_writer_t* writer )
+{
+    return json_writer_container_start( writer, true );
+}
+
+
+cy_rslt_t cy_JSON_writer_end_object( cy_JSON_writer_t* writer )
+{
+    return json_writer_container_end( writer, true );
+}
+
+
+cy_rslt_t cy_JSON_writer_begin_array( cy_JSON_writer_t* writer )
+{
+    return json_writer_container_start( writer, false );
+}
+
+
+cy_rslt_t cy_JSON_writer_end_array( cy_JSON_writer_t* writer )
+{
+    return json_writer_container_end( writer, false );
+}
+
+
+cy_rslt_t cy_JSON_writer_key( cy_JSON_writer_t* writer, const char* key, uint32_t key_length )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ( ( writer == NULL ) || ( ( key == NULL ) && ( key_length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+    if ( ( writer->depth == 0 ) || !JSON_WRITER_IS_OBJECT( writer ) || writer->after_key || writer->in_string )
+    {
+        return json_writer_result( writer, CY_RSLT_JSON_GENERIC_ERROR );
+    }
+
+    if ( !writer->first )
+    {
+        result = json_writer_put_char( writer, ',' );
+    }
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_string( writer, key, key_length );
+    }
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_char( writer, ':' );
+    }
+
+    writer->first     = false;
+    writer->after_key = true;
+
+    return json_writer_result( writer, result );
+}
+
+
+cy_rslt_t cy_JSON_writer_string( cy_JSON_writer_t* writer, const char* value, uint32_t length )
+{
+    cy_rslt_t result;
+
+    if ( ( writer == NULL ) || ( ( value == NULL ) && ( length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+
+    result = json_writer_value_start( writer );
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_string( writer, value, length );
+    }
+
+    return json_writer_result( writer, result );
+}
+
+
+cy_rslt_t cy_JSON_writer_string_part( cy_JSON_writer_t* writer, const char* value, uint32_t length, bool last )
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if ( ( writer == NULL ) || ( ( value == NULL ) && ( length != 0 ) ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+
+    /* The first part opens the string */
+    if ( !writer->in_string )
+    {
+        result = json_writer_value_start( writer );
+        if ( result == CY_RSLT_SUCCESS )
+        {
+            result = json_writer_put_char( writer, '"' );
+        }
+        writer->in_string = true;
+    }
+
+    if ( result == CY_RSLT_SUCCESS )
+    {
+        result = json_writer_put_escaped( writer, value, length );
+    }
+    if ( ( result == CY_RSLT_SUCCESS ) && last )
+    {
+        result            = json_writer_put_char( writer, '"' );
+        writer->in_string = false;
+    }
+
+    return json_writer_result( writer, result );
+}
+
+
+cy_rslt_t cy_JSON_writer_int64( cy_JSON_writer_t* writer, int64_t value )
+{
+    char     number[ JSON_WRITER_NUMBER_SIZE ];
+    char*    digit     = number + sizeof( number );
+    uint64_t magnitude = ( value < 0 ) ? ( 0 - (uint64_t)value ) : (uint64_t)value;
+
+    do
+    {
+        *--digit   = (char)( '0' + ( magnitude % 10 ) );
+        magnitude /= 10;
+    } while ( magnitude != 0 );
+
+    if ( value < 0 )
+    {
+        *--digit = '-';
+    }
+
+    return json_writer_value( writer, digit, (uint32_t)( number + sizeof( number ) - digit ) );
+}
+
+
+cy_rslt_t cy_JSON_writer_uint64( cy_JSON_writer_t* writer, uint64_t value )
+{
+    char  number[ JSON_WRITER_NUMBER_SIZE ];
+    char* digit = number + sizeof( number );
+
+    do
+    {
+        *--digit = (char)( '0' + ( value % 10 ) );
+        value   /= 10;
+    } while ( value != 0 );
+
+    return json_writer_value( writer, digit, (uint32_t)( number + sizeof( number ) - digit ) );
+}
+
+
+cy_rslt_t cy_JSON_writer_double( cy_JSON_writer_t* writer, double value )
+{
+    char     number[ JSON_WRITER_NUMBER_SIZE ];
+    int      length = 0;
+    int      digits;
+    double   magnitude = ( value < 0.0 ) ? -value : value;
+    double   scaled;
+    double   parsed;
+    uint64_t mantissa;
+    uint32_t decimals;
+
+    if ( !isfinite( value ) )
+    {
+        if ( ( writer != NULL ) && ( writer->result == CY_RSLT_SUCCESS ) )
+        {
+            writer->result = CY_RSLT_JSON_BADARG;
+        }
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    /* Look for the fewest decimals giving an integer mantissa and a power of ten which are both exact doubles. Their
+     * quotient is then correctly rounded, as by a parser: the decimal number parses back to the same double.
+     */
+    for ( decimals = 0; decimals <= JSON_WRITER_MAX_EXACT_POWER; decimals++ )
+    {
+        scaled = magnitude * json_writer_powers_of_ten[ decimals ];
+        if ( scaled >= JSON_WRITER_MAX_EXACT_INTEGER )
+        {
+            break;
+        }
+        mantissa = (uint64_t)( scaled + 0.5 );
+        parsed   = (double)mantissa / json_writer_powers_of_ten[ decimals ];
+        if ( parsed == magnitude )
+        {
+            return json_writer_value( writer, number, json_writer_decimal( number, ( value < 0.0 ) || ( ( value == 0.0 ) && signbit( value ) ), mantissa, decimals ) );
+        }
+    }
+
+    /* Large numbers, and numbers with more significant digits or a larger exponent. Most doubles parse back from 15
+     * significant digits, which avoids writing 0.1 as 0.10000000000000001
+     */
+    for ( digits = JSON_WRITER_DOUBLE_MIN_DIGITS; digits <= JSON_WRITER_DOUBLE_MAX_DIGITS; digits++ )
+    {
+        length = snprintf( number, sizeof( number ), "%.*g", digits, value );
+        if ( strtod( number, NULL ) == value )
+        {
+            break;
+        }
+    }
+
+    return json_writer_value( writer, number, json_writer_decimal_point( number, (uint32_t)length ) );
+}
+
+
+cy_rslt_t cy_JSON_writer_number( cy_JSON_writer_t* writer, const char* number, uint32_t length )
+{
+    if ( ( number == NULL ) || ( length == 0 ) )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+
+    return json_writer_value( writer, number, length );
+}
+
+
+cy_rslt_t cy_JSON_writer_bool( cy_JSON_writer_t* writer, bool value )
+{
+    return ( value ) ? json_writer_value( writer, "true", 4 ) : json_writer_value( writer, "false", 5 );
+}
+
+
+cy_rslt_t cy_JSON_writer_null( cy_JSON_writer_t* writer )
+{
+    return json_writer_value( writer, "null", 4 );
+}
+
+
+cy_rslt_t cy_JSON_writer_finish( cy_JSON_writer_t* writer, uint32_t* length )
+{
+    cy_rslt_t result;
+
+    if ( writer == NULL )
+    {
+        return CY_RSLT_JSON_BADARG;
+    }
+    if ( writer->result != CY_RSLT_SUCCESS )
+    {
+        return writer->result;
+    }
+    if ( ( writer->depth != 0 ) || writer->first || writer->in_string )
+    {
+        return CY_RSLT_JSON_INCOMPLETE;
+    }
+
+    if ( writer->flush != NULL )
+    {
+        result = json_writer_flush( writer );
+        if ( result != CY_RSLT_SUCCESS )
+        {
+            return json_writer_result( writer, result );
+        }
+    }
+
+    if ( length != NULL )
+    {
+        *length = writer->total;
+    }
+
+    return CY_RSLT_SUCCESS;
+}
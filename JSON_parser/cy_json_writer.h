@@ -0,0 +1,330 @@
+/*
+ * Copyright 2019-2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ */
+
+/**
+ * @file
+ * The JSON writer utility serializes a JSON document into a buffer provided by the application, without heap allocation.
+ *
+ * The document is written one token at a time, in document order. Member names and string values are escaped as needed,
+ * and commas and colons are inserted by the writer. When the buffer is full, its contents are passed to the flush callback
+ * of the application, for instance to send them over the network, and the buffer is reused. Without a flush callback,
+ * the whole document must fit in the buffer.
+ *
+ * Example:
+ * @code
+ * cy_JSON_writer_t writer;
+ * char             buffer[ 128 ];
+ * uint32_t         length;
+ *
+ * cy_JSON_writer_init( &writer, buffer, sizeof( buffer ), send_telemetry, socket );
+ * cy_JSON_writer_begin_object( &writer );
+ * cy_JSON_writer_key( &writer, "temp", 4 );
+ * cy_JSON_writer_double( &writer, temperature );
+ * cy_JSON_writer_key( &writer, "mode", 4 );
+ * cy_JSON_writer_string( &writer, mode, strlen( mode ) );
+ * cy_JSON_writer_end_object( &writer );
+ * result = cy_JSON_writer_finish( &writer, &length );
+ * @endcode
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "cy_result_mw.h"
+#include "cy_json_parser.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup json_utils
+ */
+/******************************************************
+ *                      Macros
+ ******************************************************/
+
+/** Maximum nesting depth of objects and arrays written by the JSON writer. Costs one bit of cy_JSON_writer_t per level */
+#ifndef CY_JSON_WRITER_MAX_DEPTH
+#define CY_JSON_WRITER_MAX_DEPTH (32)
+#endif
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+/******************************************************
+ *                 Type Definitions
+ ******************************************************/
+/******************************************************************************/
+/** \addtogroup group_json_structures
+ *//** \{ */
+/******************************************************************************/
+
+/** Flush callback of the JSON writer
+ *
+ * @param[in] data   : Part of the JSON document written so far, which follows the part of the previous call
+ * @param[in] length : Length of the data
+ * @param[in] arg    : User argument passed to @ref cy_JSON_writer_init
+ *
+ * @return CY_RSLT_SUCCESS to go on writing. Any other value stops the writer, and is returned by all its later calls.
+ */
+typedef cy_rslt_t (*cy_JSON_writer_flush_t)( const char* data, uint32_t length, void* arg );
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/** JSON writer. The members are internal to the JSON writer and must not be accessed directly by the application */
+typedef struct
+{
+    char*                   buffer;         /**< Buffer provided by the application */
+    uint32_t                size;           /**< Size of the buffer */
+    uint32_t                used;           /**< Bytes of the buffer not flushed yet */
+    uint32_t                total;          /**< Length of the document written so far */
+    cy_JSON_writer_flush_t  flush;          /**< Flush callback, NULL if there is none */
+    void*                   argument;       /**< User argument of the flush callback */
+    cy_rslt_t               result;         /**< First error, returned by all later calls */
+    uint32_t                depth;          /**< Number of open objects and arrays */
+    bool                    first;          /**< Set until the first member or element of the innermost container is written */
+    bool                    after_key;      /**< Set after a member name, until its value is written */
+    bool                    in_string;      /**< Set while a string value is written in parts */
+    uint8_t                 containers[ ( CY_JSON_WRITER_MAX_DEPTH + 7 ) / 8 ]; /**< One bit per open container, set for objects */
+} cy_JSON_writer_t;
+
+/** \} */
+
+/******************************************************
+ *                 Global Variables
+ ******************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ *  @addtogroup group_json_func
+ *
+ *  @{
+ */
+/*****************************************************************************/
+
+/** Initialize a JSON writer before the first token of a JSON document
+ *
+ * @param[out] writer : Pointer to the JSON writer
+ * @param[in]  buffer : Buffer the document is written to
+ * @param[in]  size   : Size of the buffer
+ * @param[in]  flush  : Optional; called with the contents of the buffer when it is full, and by @ref cy_JSON_writer_finish.
+ *                      Without a flush callback, CY_RSLT_JSON_BUFFER_OVERFLOW is returned when the buffer is full.
+ * @param[in]  arg    : User argument passed to the flush callback
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_writer_init( cy_JSON_writer_t* writer, char* buffer, uint32_t size, cy_JSON_writer_flush_t flush, void* arg );
+
+/** Write the start of an object
+ *
+ * All the writer functions return the first error met by the writer, so that the application may check the result of
+ * @ref cy_JSON_writer_finish only.
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_DEPTH_EXCEEDED if objects and arrays are nested deeper than CY_JSON_WRITER_MAX_DEPTH
+ *                    - CY_RSLT_JSON_GENERIC_ERROR if a value is not expected here: the document root is complete,
+ *                      or a member name is expected
+ *                    - CY_RSLT_JSON_BUFFER_OVERFLOW if the buffer is full and there is no flush callback
+ *                    - Any error returned by the flush callback
+ *                    - CY_RSLT_JSON_BADARG
+ */
+cy_rslt_t cy_JSON_writer_begin_object( cy_JSON_writer_t* writer );
+
+/** Write the end of the innermost object
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_GENERIC_ERROR if the innermost container is not an object, or its last member has no value
+ *                    - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_end_object( cy_JSON_writer_t* writer );
+
+/** Write the start of an array
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_begin_array( cy_JSON_writer_t* writer );
+
+/** Write the end of the innermost array
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_GENERIC_ERROR if the innermost container is not an array
+ *                    - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_end_array( cy_JSON_writer_t* writer );
+
+/** Write the name of the next member of the innermost object
+ *
+ * The name is escaped as needed; it is expected in UTF-8.
+ *
+ * @param[in] writer     : Pointer to a JSON writer
+ * @param[in] key        : Member name, which need not be NUL terminated
+ * @param[in] key_length : Length of the member name
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_GENERIC_ERROR if the innermost container is not an object, or the previous member has no value
+ *                    - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_key( cy_JSON_writer_t* writer, const char* key, uint32_t key_length );
+
+/** Write a string value
+ *
+ * The string is escaped as needed: quotes, backslashes and control characters. It is expected in UTF-8.
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : String, which need not be NUL terminated
+ * @param[in] length : Length of the string
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_string( cy_JSON_writer_t* writer, const char* value, uint32_t length );
+
+/** Write a string value in parts, for instance as it is received
+ *
+ * The first part opens the string, and the part with `last` set closes it. No other token can be written in between.
+ * Each part is escaped as by @ref cy_JSON_writer_string; a UTF-8 sequence may be split across parts.
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : Part of the string, which need not be NUL terminated
+ * @param[in] length : Length of the part, which may be 0
+ * @param[in] last   : Set for the last part of the string
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_string_part( cy_JSON_writer_t* writer, const char* value, uint32_t length, bool last );
+
+/** Write a signed integer value
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : Value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_int64( cy_JSON_writer_t* writer, int64_t value );
+
+/** Write an unsigned integer value
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : Value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_uint64( cy_JSON_writer_t* writer, uint64_t value );
+
+/** Write a number value
+ *
+ * The number is written with the fewest significant digits, up to 17, which parse back to the same double.
+ * Most numbers are formatted directly; others are formatted with snprintf(). The decimal point is always a '.',
+ * whatever the LC_NUMERIC locale.
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : Value, which must be finite: JSON has no representation of infinities and NaN
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_double( cy_JSON_writer_t* writer, double value );
+
+/** Write a number value given as text
+ *
+ * The text is written as it is, for instance a number taken from a parsed JSON document. It must be a JSON number.
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] number : Number, which need not be NUL terminated
+ * @param[in] length : Length of the number
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_number( cy_JSON_writer_t* writer, const char* number, uint32_t length );
+
+/** Write true or false
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ * @param[in] value  : Value
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_bool( cy_JSON_writer_t* writer, bool value );
+
+/** Write null
+ *
+ * @param[in] writer : Pointer to a JSON writer
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - Any error listed for @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_null( cy_JSON_writer_t* writer );
+
+/** Complete the JSON document
+ *
+ * The rest of the document is passed to the flush callback, if any. Otherwise the document is in the buffer.
+ * The writer may then be initialized again for the next document.
+ *
+ * @param[in]  writer : Pointer to a JSON writer
+ * @param[out] length : Optional; set to the length of the whole document
+ *
+ * @return on success - CY_RSLT_SUCCESS
+ *         on failure - CY_RSLT_JSON_INCOMPLETE if the document root is not complete
+ *                    - Any error met by the writer, see @ref cy_JSON_writer_begin_object
+ */
+cy_rslt_t cy_JSON_writer_finish( cy_JSON_writer_t* writer, uint32_t* length );
+
+/** @} */
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif